@@ -0,0 +1,178 @@
+#ifndef MOD_BENCHMARK_H
+#define MOD_BENCHMARK_H
+
+// Shared harness for the C++ benchmarks.
+// Each case is run a number of times (MOD_BENCHMARK_REPETITIONS, default 3) and summarised as one JSON object
+// on a single line, printed to stdout and appended to the file given as the first command line argument, if any.
+// Only the part between Measurement::start() and Measurement::stop() is timed,
+// so each repetition can set up fresh inputs without warm caches.
+// The peak resident set size is that of the process so far, so the cases of a benchmark should be run
+// in order of increasing size.
+
+#include <mod/Config.hpp>
+#include <mod/Misc.hpp>
+#include <mod/graph/Graph.hpp>
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mod {
+namespace benchmark {
+
+struct Measurement {
+	void start() {
+		isoCallsBefore = getConfig().graph.numIsomorphismCalls.get();
+		startTime = std::chrono::steady_clock::now();
+	}
+
+	void stop() {
+		const auto stopTime = std::chrono::steady_clock::now();
+		seconds = std::chrono::duration<double>(stopTime - startTime).count();
+		numIsomorphismCalls = getConfig().graph.numIsomorphismCalls.get() - isoCallsBefore;
+	}
+
+	// Records a case specific number, e.g., the size of the result.
+	void set(const std::string &name, double value) {
+		for(auto &c : counters) {
+			if(c.first == name) {
+				c.second = value;
+				return;
+			}
+		}
+		counters.emplace_back(name, value);
+	}
+public:
+	double seconds = 0;
+	unsigned long numIsomorphismCalls = 0;
+	std::vector<std::pair<std::string, double> > counters;
+private:
+	std::chrono::steady_clock::time_point startTime;
+	unsigned long isoCallsBefore = 0;
+};
+
+struct Runner {
+	Runner(std::string benchmark, int argc, char **argv) : benchmark(std::move(benchmark)) {
+		if(argc > 1) outFile = argv[1];
+		if(const char *env = std::getenv("MOD_BENCHMARK_REPETITIONS"))
+			repetitions = std::max(1, std::atoi(env));
+	}
+
+	// Runs f(Measurement&) repeatedly and reports the summary.
+	// The counters and number of isomorphism calls are those of the last repetition.
+	template<typename F>
+	void run(const std::string &caseName, F f) {
+		std::vector<double> seconds;
+		Measurement last;
+		for(int i = 0; i != repetitions; ++i) {
+			Measurement m;
+			f(m);
+			seconds.push_back(m.seconds);
+			last = std::move(m);
+		}
+		std::sort(seconds.begin(), seconds.end());
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+
+		std::ostringstream s;
+		s << std::setprecision(6);
+		s << "{\"benchmark\": \"" << benchmark << "\", \"case\": \"" << caseName << "\""
+		  << ", \"version\": \"" << version() << "\""
+		  << ", \"numThreads\": " << getConfig().common.numThreads.get()
+		  << ", \"repetitions\": " << repetitions
+		  << ", \"secondsMin\": " << seconds.front()
+		  << ", \"secondsMedian\": " << seconds[seconds.size() / 2]
+		  << ", \"secondsMax\": " << seconds.back()
+		  << ", \"peakRSSKiB\": " << usage.ru_maxrss
+		  << ", \"numIsomorphismCalls\": " << last.numIsomorphismCalls;
+		for(const auto &c : last.counters)
+			s << ", \"" << c.first << "\": " << c.second;
+		s << "}";
+		std::cout << s.str() << std::endl;
+		if(!outFile.empty()) {
+			std::ofstream out(outFile, std::ios::app);
+			out << s.str() << std::endl;
+		}
+	}
+private:
+	std::string benchmark;
+	std::string outFile;
+	int repetitions = 3;
+};
+
+inline LabelSettings labelSettings() {
+	return LabelSettings(LabelType::String, LabelRelation::Isomorphism);
+}
+
+inline std::vector<std::shared_ptr<graph::Graph> > parseSmiles(const std::vector<std::string> &smiles) {
+	std::vector<std::shared_ptr<graph::Graph> > graphs;
+	graphs.reserve(smiles.size());
+	for(const auto &s : smiles)
+		graphs.push_back(graph::Graph::smiles(s));
+	return graphs;
+}
+
+// Generates SMILES strings for up to 'count' pairwise non-isomorphic acyclic molecules with the
+// given number of carbon and oxygen atoms, i.e., constitutional isomers.
+// The strings are written from random spanning trees, so they are generally not canonical.
+// The generation is deterministic for a given seed.
+inline std::vector<std::string> makeIsomerSmiles(int numC, int numO, std::size_t count, unsigned int seed) {
+	const int n = numC + numO;
+	std::mt19937 rng(seed);
+	std::vector<std::string> res;
+	std::set<std::string> seen;
+	// bounds the number of attempts, as there may be fewer isomers than requested
+	for(std::size_t attempt = 0; attempt != 100 * count && res.size() != count; ++attempt) {
+		std::vector<int> parent(n, -1), degree(n, 0);
+		for(int v = 1; v != n; ++v) {
+			int p;
+			do {
+				p = std::uniform_int_distribution<int>(0, v - 1)(rng);
+			} while(degree[p] == 4);
+			parent[v] = p;
+			++degree[p];
+			++degree[v];
+		}
+		std::vector<int> candidates;
+		for(int v = 0; v != n; ++v)
+			if(degree[v] <= 2) candidates.push_back(v);
+		if(candidates.size() < std::size_t(numO)) continue;
+		std::shuffle(candidates.begin(), candidates.end(), rng);
+		std::vector<char> isO(n, false);
+		for(int i = 0; i != numO; ++i) isO[candidates[i]] = true;
+
+		std::vector<std::vector<int> > children(n);
+		for(int v = 1; v != n; ++v) children[parent[v]].push_back(v);
+		std::string smiles;
+		const auto write = [&](int v, const auto &write) -> void {
+			smiles += isO[v] ? 'O' : 'C';
+			for(std::size_t i = 0; i != children[v].size(); ++i) {
+				const bool isLast = i + 1 == children[v].size();
+				if(!isLast) smiles += '(';
+				write(children[v][i], write);
+				if(!isLast) smiles += ')';
+			}
+		};
+		write(0, write);
+		// deduplicate by the canonical SMILES of a throwaway graph
+		if(!seen.insert(graph::Graph::smiles(smiles)->getSmiles()).second) continue;
+		res.push_back(std::move(smiles));
+	}
+	return res;
+}
+
+} // namespace benchmark
+} // namespace mod
+
+#endif /* MOD_BENCHMARK_H */
@@ -0,0 +1,94 @@
+#ifndef MOD_BENCHMARK_FORMOSE_H
+#define MOD_BENCHMARK_FORMOSE_H
+
+// The formose grammar from examples/py/050_formoseGrammar.py.
+
+#include <mod/dg/Strategies.hpp>
+#include <mod/graph/Graph.hpp>
+#include <mod/rule/Rule.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mod {
+namespace benchmark {
+
+struct Formose {
+	Formose() {
+		const std::string ketoEnolGML = R"(rule [
+	ruleID "Keto-enol isomerization"
+	left [
+		edge [ source 1 target 4 label "-" ]
+		edge [ source 1 target 2 label "-" ]
+		edge [ source 2 target 3 label "=" ]
+	]
+	context [
+		node [ id 1 label "C" ]
+		node [ id 2 label "C" ]
+		node [ id 3 label "O" ]
+		node [ id 4 label "H" ]
+	]
+	right [
+		edge [ source 1 target 2 label "=" ]
+		edge [ source 2 target 3 label "-" ]
+		edge [ source 3 target 4 label "-" ]
+	]
+])";
+		const std::string aldolAddGML = R"(rule [
+	ruleID "Aldol Addition"
+	left [
+		edge [ source 1 target 2 label "=" ]
+		edge [ source 2 target 3 label "-" ]
+		edge [ source 3 target 4 label "-" ]
+		edge [ source 5 target 6 label "=" ]
+	]
+	context [
+		node [ id 1 label "C" ]
+		node [ id 2 label "C" ]
+		node [ id 3 label "O" ]
+		node [ id 4 label "H" ]
+		node [ id 5 label "O" ]
+		node [ id 6 label "C" ]
+	]
+	right [
+		edge [ source 1 target 2 label "-" ]
+		edge [ source 2 target 3 label "=" ]
+		edge [ source 5 target 6 label "-" ]
+		edge [ source 4 target 5 label "-" ]
+		edge [ source 6 target 1 label "-" ]
+	]
+])";
+		formaldehyde = graph::Graph::smiles("C=O");
+		glycolaldehyde = graph::Graph::smiles("OCC=O");
+		rules = {
+				rule::Rule::ruleGMLString(ketoEnolGML, false),
+				rule::Rule::ruleGMLString(ketoEnolGML, true),
+				rule::Rule::ruleGMLString(aldolAddGML, false),
+				rule::Rule::ruleGMLString(aldolAddGML, true)
+		};
+	}
+
+	std::vector<std::shared_ptr<graph::Graph> > graphs() const {
+		return {formaldehyde, glycolaldehyde};
+	}
+
+	// addSubset(graphs()) >> repeat[numRounds](rules)
+	std::shared_ptr<dg::Strategy> strategy(std::size_t numRounds) const {
+		std::vector<std::shared_ptr<dg::Strategy> > ruleStrats;
+		for(const auto &r : rules)
+			ruleStrats.push_back(dg::Strategy::makeRule(r));
+		return dg::Strategy::makeSequence({
+				dg::Strategy::makeAdd(false, graphs(), IsomorphismPolicy::Check),
+				dg::Strategy::makeRepeat(numRounds, dg::Strategy::makeParallel(ruleStrats))
+		});
+	}
+public:
+	std::shared_ptr<graph::Graph> formaldehyde, glycolaldehyde;
+	std::vector<std::shared_ptr<rule::Rule> > rules;
+};
+
+} // namespace benchmark
+} // namespace mod
+
+#endif /* MOD_BENCHMARK_FORMOSE_H */
@@ -0,0 +1,34 @@
+// Loading of derivation graph dumps in the text and binary formats,
+// with a derivation graph from the formose grammar.
+#include "Benchmark.hpp"
+#include "Formose.hpp"
+
+#include <mod/dg/Builder.hpp>
+#include <mod/dg/DG.hpp>
+
+using namespace mod;
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("dgDump", argc, argv);
+	const std::size_t numRounds = 3;
+	std::string textFile, binaryFile;
+	{
+		const benchmark::Formose formose;
+		auto dg = dg::DG::make(benchmark::labelSettings(), {}, IsomorphismPolicy::Check);
+		dg->build().execute(formose.strategy(numRounds));
+		textFile = dg->dump();
+		binaryFile = dg->dumpBinary();
+	}
+	const auto run = [&](const std::string &caseName, const std::string &file) {
+		runner.run(caseName, [&](benchmark::Measurement &m) {
+			const benchmark::Formose formose;
+			m.start();
+			auto dg = dg::DG::dumpImport({}, formose.rules, file);
+			m.stop();
+			m.set("numVertices", dg->numVertices());
+			m.set("numEdges", dg->numEdges());
+		});
+	};
+	run("rounds=" + std::to_string(numRounds) + "/text", textFile);
+	run("rounds=" + std::to_string(numRounds) + "/binary", binaryFile);
+}
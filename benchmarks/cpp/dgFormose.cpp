@@ -0,0 +1,26 @@
+// Derivation graph expansion with the formose grammar for an increasing number of rounds.
+#include "Benchmark.hpp"
+#include "Formose.hpp"
+
+#include <mod/dg/Builder.hpp>
+#include <mod/dg/DG.hpp>
+
+using namespace mod;
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("dgFormose", argc, argv);
+	for(std::size_t numRounds : {1, 2, 3, 4}) {
+		runner.run("rounds=" + std::to_string(numRounds), [&](benchmark::Measurement &m) {
+			const benchmark::Formose formose;
+			auto dg = dg::DG::make(benchmark::labelSettings(), {}, IsomorphismPolicy::Check);
+			{
+				auto b = dg->build();
+				m.start();
+				b.execute(formose.strategy(numRounds));
+				m.stop();
+			}
+			m.set("numVertices", dg->numVertices());
+			m.set("numEdges", dg->numEdges());
+		});
+	}
+}
@@ -0,0 +1,78 @@
+// Allocations of intermediary rules during rule application with a rule with 3 connected components,
+// with and without the rule arenas.
+// Each allocation served by an arena would otherwise have been a heap allocation,
+// so numRuleArenaAllocations - numRuleArenaBlocks is the reduction in calls to malloc.
+#include "Benchmark.hpp"
+
+#include <mod/dg/Builder.hpp>
+#include <mod/dg/DG.hpp>
+#include <mod/dg/Strategies.hpp>
+#include <mod/rule/Rule.hpp>
+
+using namespace mod;
+
+namespace {
+
+// the trimerisation of carbonyl groups to a 1,3,5-trioxane ring
+const std::string trimerisationGML = R"(rule [
+	ruleID "trimerisation"
+	left [
+		edge [ source 1 target 2 label "=" ]
+		edge [ source 3 target 4 label "=" ]
+		edge [ source 5 target 6 label "=" ]
+	]
+	context [
+		node [ id 1 label "C" ] node [ id 2 label "O" ]
+		node [ id 3 label "C" ] node [ id 4 label "O" ]
+		node [ id 5 label "C" ] node [ id 6 label "O" ]
+	]
+	right [
+		edge [ source 1 target 2 label "-" ]
+		edge [ source 3 target 4 label "-" ]
+		edge [ source 5 target 6 label "-" ]
+		edge [ source 2 target 3 label "-" ]
+		edge [ source 4 target 5 label "-" ]
+		edge [ source 6 target 1 label "-" ]
+	]
+])";
+
+const std::vector<std::string> graphSmiles = {
+		"C=O", "CC=O", "CCC=O", "CC(C)=O", "CCC(C)=O",
+		"O=CC=O", "OCC=O", "CC(=O)C=O", "O=CCCC=O", "CC(C)C=O",
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("dgRuleArena", argc, argv);
+	const auto r = rule::Rule::ruleGMLString(trimerisationGML, false);
+	for(const bool useArena : {false, true}) {
+		getConfig().dg.useRuleArena.set(useArena);
+		runner.run(useArena ? "arena" : "heap", [&](benchmark::Measurement &m) {
+			const auto graphs = benchmark::parseSmiles(graphSmiles);
+			const auto strategy = dg::Strategy::makeSequence({
+					dg::Strategy::makeAdd(false, graphs, IsomorphismPolicy::Check),
+					dg::Strategy::makeRule(r)
+			});
+			auto &config = getConfig().dg;
+			const auto allocationsBefore = config.numRuleArenaAllocations.get();
+			const auto blocksBefore = config.numRuleArenaBlocks.get();
+			auto dg = dg::DG::make(benchmark::labelSettings(), graphs, IsomorphismPolicy::Check);
+			std::size_t numCompositions = 0;
+			{
+				auto b = dg->build();
+				m.start();
+				const auto res = b.execute(strategy);
+				m.stop();
+				for(const auto &rs : res.getStatistics().rules)
+					numCompositions += rs.compositions;
+			}
+			m.set("numVertices", dg->numVertices());
+			m.set("numEdges", dg->numEdges());
+			m.set("numCompositions", numCompositions);
+			m.set("numRuleArenaAllocations", config.numRuleArenaAllocations.get() - allocationsBefore);
+			m.set("numRuleArenaBlocks", config.numRuleArenaBlocks.get() - blocksBefore);
+		});
+	}
+	getConfig().dg.useRuleArena.set(true);
+}
@@ -0,0 +1,36 @@
+// Insertion of sets of constitutional isomers into the graph database of a derivation graph,
+// where every graph must be checked against the graphs already inserted.
+#include "Benchmark.hpp"
+
+#include <mod/dg/DG.hpp>
+
+using namespace mod;
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("graphCollection", argc, argv);
+	const auto algName = [](Config::IsomorphismAlg alg) {
+		switch(alg) {
+		case Config::IsomorphismAlg::VF2: return "VF2";
+		case Config::IsomorphismAlg::Canon: return "Canon";
+		case Config::IsomorphismAlg::SmilesCanonVF2: return "SmilesCanonVF2";
+		}
+		return "";
+	};
+	for(int numC : {8, 10, 12}) {
+		const auto smiles = benchmark::makeIsomerSmiles(numC, 2, 2000, 42);
+		for(const auto alg : {Config::IsomorphismAlg::VF2, Config::IsomorphismAlg::Canon}) {
+			getConfig().graph.isomorphismAlg.set(alg);
+			const auto caseName = "C" + std::to_string(numC) + "O2/" + algName(alg);
+			runner.run(caseName, [&](benchmark::Measurement &m) {
+				const auto graphs = benchmark::parseSmiles(smiles);
+				const auto hitsBefore = getConfig().graph.numCollectionHits.get();
+				m.start();
+				auto dg = dg::DG::make(benchmark::labelSettings(), graphs, IsomorphismPolicy::Check);
+				m.stop();
+				m.set("numGraphs", graphs.size());
+				m.set("numCollectionHits", getConfig().graph.numCollectionHits.get() - hitsBefore);
+			});
+		}
+	}
+	getConfig().graph.isomorphismAlg.set(Config::IsomorphismAlg::VF2);
+}
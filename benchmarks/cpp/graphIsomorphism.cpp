@@ -0,0 +1,47 @@
+// Pairwise isomorphism checks among constitutional isomers and permuted copies of them,
+// with VF2 and with comparison of canonical forms, the latter both including and excluding the canonicalisation.
+#include "Benchmark.hpp"
+
+using namespace mod;
+
+namespace {
+
+std::vector<std::shared_ptr<graph::Graph> > makeGraphs(const std::vector<std::string> &smiles) {
+	rngReseed(42);
+	auto graphs = benchmark::parseSmiles(smiles);
+	const auto numIsomers = graphs.size();
+	for(std::size_t i = 0; i != numIsomers; ++i)
+		graphs.push_back(graphs[i]->makePermutation());
+	return graphs;
+}
+
+std::size_t allPairs(const std::vector<std::shared_ptr<graph::Graph> > &graphs) {
+	std::size_t numIsomorphic = 0;
+	for(std::size_t i = 0; i != graphs.size(); ++i)
+		for(std::size_t j = i + 1; j != graphs.size(); ++j)
+			numIsomorphic += graphs[i]->isomorphism(graphs[j], 1, benchmark::labelSettings());
+	return numIsomorphic;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("graphIsomorphism", argc, argv);
+	const auto smiles = benchmark::makeIsomerSmiles(10, 2, 300, 42);
+	const auto run = [&](const std::string &caseName, Config::IsomorphismAlg alg, bool precompute) {
+		getConfig().graph.isomorphismAlg.set(alg);
+		runner.run(caseName, [&](benchmark::Measurement &m) {
+			const auto graphs = makeGraphs(smiles);
+			if(precompute) graph::Graph::precompute(graphs, benchmark::labelSettings());
+			m.start();
+			const auto numIsomorphic = allPairs(graphs);
+			m.stop();
+			m.set("numGraphs", graphs.size());
+			m.set("numIsomorphicPairs", numIsomorphic);
+		});
+	};
+	run("VF2", Config::IsomorphismAlg::VF2, false);
+	run("Canon", Config::IsomorphismAlg::Canon, false);
+	run("CanonPrecomputed", Config::IsomorphismAlg::Canon, true);
+	getConfig().graph.isomorphismAlg.set(Config::IsomorphismAlg::VF2);
+}
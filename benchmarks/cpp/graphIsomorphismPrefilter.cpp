@@ -0,0 +1,55 @@
+// How many graph isomorphism and monomorphism checks are decided by the cached graph invariants
+// instead of reaching VF2, among constitutional isomers and near-isomers, i.e., graphs with equal sizes.
+#include "Benchmark.hpp"
+
+using namespace mod;
+
+namespace {
+
+const std::vector<std::string> graphSmiles = {
+		"CCCCCC", "CC(C)CCC", "CCC(C)CC", "CC(C)(C)CC", "CC(C)C(C)C",
+		"CCCCCO", "CC(C)CCO", "CCC(C)CO", "CC(C)(C)CO", "CCCC(C)O",
+		"CCCCOC", "CCCOCC", "CC(C)OCC", "CC(C)COC", "COC(C)(C)C",
+		"OCCCCO", "OCC(O)CC", "OC(C)C(O)C", "OCC(C)(C)O", "COCCOC",
+		"O=CCCCC", "O=C(C)CCC", "CCC(=O)CC", "O=CC(C)CC", "O=C(C)C(C)C",
+		"OC(=O)CCC", "OC(=O)C(C)C", "COC(=O)CC", "CCOC(=O)C", "CCCOC=O",
+		"OCC(O)C(O)CO", "OCC(O)C(O)C=O", "OCC(=O)C(O)CO", "OCC(O)CO", "OCC(O)C=O",
+};
+const std::vector<std::string> patternSmiles = {"C=O", "CO", "OC=O", "CC(C)C", "OCCO", "CC(C)(C)C", "COC"};
+
+} // namespace
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("graphIsomorphismPrefilter", argc, argv);
+	getConfig().graph.isomorphismAlg.set(Config::IsomorphismAlg::VF2);
+	const auto run = [&](const std::string &caseName, const auto &count) {
+		runner.run(caseName, [&](benchmark::Measurement &m) {
+			const auto graphs = benchmark::parseSmiles(graphSmiles);
+			const auto patterns = benchmark::parseSmiles(patternSmiles);
+			auto &config = getConfig().graph;
+			const auto rejectsBefore = config.numInvariantRejects.get();
+			const auto vf2Before = config.numVF2Calls.get();
+			m.start();
+			const std::size_t numPositive = count(graphs, patterns);
+			m.stop();
+			m.set("numPositive", numPositive);
+			m.set("numInvariantRejects", config.numInvariantRejects.get() - rejectsBefore);
+			m.set("numVF2Calls", config.numVF2Calls.get() - vf2Before);
+		});
+	};
+	using Graphs = std::vector<std::shared_ptr<graph::Graph> >;
+	run("isomorphism", [](const Graphs &graphs, const Graphs &) {
+		std::size_t res = 0;
+		for(const auto &a : graphs)
+			for(const auto &b : graphs)
+				res += a->isomorphism(b, 1, benchmark::labelSettings());
+		return res;
+	});
+	run("monomorphism", [](const Graphs &graphs, const Graphs &patterns) {
+		std::size_t res = 0;
+		for(const auto &p : patterns)
+			for(const auto &g : graphs)
+				res += p->monomorphism(g, 1, benchmark::labelSettings());
+		return res;
+	});
+}
@@ -0,0 +1,41 @@
+// Supergraph composition of rules with the formose grammar,
+// both of identity rules of graphs with the grammar and of the grammar with itself.
+#include "Benchmark.hpp"
+#include "Formose.hpp"
+
+#include <mod/rule/Composer.hpp>
+#include <mod/rule/CompositionExpr.hpp>
+
+using namespace mod;
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("rcSuper", argc, argv);
+	const auto run = [&](const std::string &caseName, auto makeExp) {
+		runner.run(caseName, [&](benchmark::Measurement &m) {
+			const benchmark::Formose formose;
+			const rule::RCExp::Expression exp = makeExp(formose);
+			auto rc = rule::Composer::create({}, benchmark::labelSettings());
+			m.start();
+			const auto res = rc->eval(exp, 0);
+			m.stop();
+			m.set("numResults", res.size());
+			m.set("numProducts", rc->getProducts().size());
+		});
+	};
+	const auto grammar = [](const benchmark::Formose &formose) {
+		std::vector<rule::RCExp::Expression> rules(formose.rules.begin(), formose.rules.end());
+		return rule::RCExp::Union(std::move(rules));
+	};
+	run("graphs*grammar", [&](const benchmark::Formose &formose) {
+		const auto graphs = rule::RCExp::ComposeParallel(rule::RCExp::Id(formose.formaldehyde),
+		                                                 rule::RCExp::Id(formose.glycolaldehyde), true);
+		return rule::RCExp::ComposeSuper(graphs, grammar(formose), true, true, false);
+	});
+	run("grammar*grammar", [&](const benchmark::Formose &formose) {
+		return rule::RCExp::ComposeSuper(grammar(formose), grammar(formose), true, true, false);
+	});
+	run("(grammar*grammar)*grammar", [&](const benchmark::Formose &formose) {
+		const auto first = rule::RCExp::ComposeSuper(grammar(formose), grammar(formose), true, true, false);
+		return rule::RCExp::ComposeSuper(first, grammar(formose), true, true, false);
+	});
+}
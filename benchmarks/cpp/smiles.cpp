@@ -0,0 +1,28 @@
+// Parsing of SMILES strings and writing of canonical SMILES strings for constitutional isomers.
+#include "Benchmark.hpp"
+
+using namespace mod;
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("smiles", argc, argv);
+	for(int numC : {8, 12, 16}) {
+		const auto smiles = benchmark::makeIsomerSmiles(numC, 3, 2000, 42);
+		const auto caseName = "C" + std::to_string(numC) + "O3";
+		runner.run(caseName + "/parse", [&](benchmark::Measurement &m) {
+			m.start();
+			const auto graphs = benchmark::parseSmiles(smiles);
+			m.stop();
+			m.set("numGraphs", graphs.size());
+		});
+		runner.run(caseName + "/write", [&](benchmark::Measurement &m) {
+			const auto graphs = benchmark::parseSmiles(smiles);
+			std::size_t numChars = 0;
+			m.start();
+			for(const auto &g : graphs)
+				numChars += g->getSmiles().size();
+			m.stop();
+			m.set("numGraphs", graphs.size());
+			m.set("numChars", numChars);
+		});
+	}
+}
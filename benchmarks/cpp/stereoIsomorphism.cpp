@@ -0,0 +1,83 @@
+// Pairwise isomorphism checks with stereo information among stereoisomers and separately parsed copies of them,
+// with VF2, with comparison of canonical SMILES strings, and with comparison of canonical forms.
+// Only the stereo information distinguishes many of the pairs, so the canonical comparisons must fall back to VF2.
+#include "Benchmark.hpp"
+
+using namespace mod;
+
+namespace {
+
+// All stereoisomers of a template, where each '%' is replaced by "@" or "@@",
+// and each '|' by "/" or "\".
+std::vector<std::string> expandStereo(const std::string &pattern) {
+	std::vector<std::string> res{""};
+	for(const char c : pattern) {
+		std::vector<std::string> next;
+		for(const auto &prefix : res) {
+			if(c == '%') {
+				next.push_back(prefix + "@");
+				next.push_back(prefix + "@@");
+			} else if(c == '|') {
+				next.push_back(prefix + "/");
+				next.push_back(prefix + "\\");
+			} else {
+				next.push_back(prefix + c);
+			}
+		}
+		res = std::move(next);
+	}
+	return res;
+}
+
+std::vector<std::string> makeSmiles() {
+	std::vector<std::string> res;
+	for(const char *pattern : {
+			"OC[C%H]1OC(O)[C%H](O)[C%H](O)[C%H]1O", // aldohexopyranoses
+			"OC[C%H]1O[C%H](O)[C%H](O)[C%H](O)[C%H]1O", // with the anomeric centre
+			"OC(=O)[C%H](O)[C%H](O)C(=O)O", // tartaric acids
+			"F|C=C|C=C|C=C|C=C|F" // polyenes
+	}) {
+		const auto expanded = expandStereo(pattern);
+		res.insert(res.end(), expanded.begin(), expanded.end());
+	}
+	return res;
+}
+
+std::vector<std::shared_ptr<graph::Graph> > makeGraphs(const std::vector<std::string> &smiles) {
+	// the same molecules twice, as separate graphs
+	auto graphs = benchmark::parseSmiles(smiles);
+	const auto copies = benchmark::parseSmiles(smiles);
+	graphs.insert(graphs.end(), copies.begin(), copies.end());
+	return graphs;
+}
+
+std::size_t allPairs(const std::vector<std::shared_ptr<graph::Graph> > &graphs, LabelSettings ls) {
+	std::size_t numIsomorphic = 0;
+	for(std::size_t i = 0; i != graphs.size(); ++i)
+		for(std::size_t j = i + 1; j != graphs.size(); ++j)
+			numIsomorphic += graphs[i]->isomorphism(graphs[j], 1, ls);
+	return numIsomorphic;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+	benchmark::Runner runner("stereoIsomorphism", argc, argv);
+	const auto smiles = makeSmiles();
+	const LabelSettings ls(LabelType::String, LabelRelation::Isomorphism, LabelRelation::Isomorphism);
+	const auto run = [&](const std::string &caseName, Config::IsomorphismAlg alg) {
+		getConfig().graph.isomorphismAlg.set(alg);
+		runner.run(caseName, [&](benchmark::Measurement &m) {
+			const auto graphs = makeGraphs(smiles);
+			m.start();
+			const auto numIsomorphic = allPairs(graphs, ls);
+			m.stop();
+			m.set("numGraphs", graphs.size());
+			m.set("numIsomorphicPairs", numIsomorphic);
+		});
+	};
+	run("VF2", Config::IsomorphismAlg::VF2);
+	run("SmilesCanonVF2", Config::IsomorphismAlg::SmilesCanonVF2);
+	run("Canon", Config::IsomorphismAlg::Canon);
+	getConfig().graph.isomorphismAlg.set(Config::IsomorphismAlg::VF2);
+}
@@ -56,6 +56,9 @@ function gen_file_lists {
 	echo "set(mod_TEST_CPP_FILES"
 	find test/cpp -iname "*.cpp" | sed -e "s!^test/!!" -e 's!\.cpp$!!' | indent
 	echo ")"
+	echo "set(mod_BENCHMARK_CPP_FILES"
+	find benchmarks/cpp -iname "*.cpp" | sed -e "s!^benchmarks/!!" -e 's!\.cpp$!!' | indent
+	echo ")"
 	echo ""
 	echo "set(mod_EXAMPLES_PY_FILES"
 	find examples/py -iname "*.py" | sed -e "s!^examples/!!" -e 's!\.py$!!' | indent
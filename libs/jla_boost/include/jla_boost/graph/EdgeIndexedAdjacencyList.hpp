@@ -3,15 +3,23 @@
 
 #include <boost/graph/adjacency_list.hpp>
 
+#include <vector>
+
 namespace jla_boost {
 
+// A storage selector for adjacency_list which gives std::vector with the given allocator.
+template<template<typename> class Allocator>
+struct VecWithAllocatorS {
+};
+
 template<typename DirectedS,
 typename VertexProperty = boost::no_property,
 typename EdgeProperty = boost::no_property,
-typename GraphProperty = boost::no_property>
+typename GraphProperty = boost::no_property,
+typename OutEdgeListS = boost::vecS>
 struct EdgeIndexedAdjacencyList {
 	using Self = EdgeIndexedAdjacencyList;
-	using GraphType = boost::adjacency_list< boost::vecS, boost::vecS, DirectedS,
+	using GraphType = boost::adjacency_list<OutEdgeListS, boost::vecS, DirectedS,
 			VertexProperty, boost::property<boost::edge_index_t, std::size_t, EdgeProperty>, GraphProperty,
 			boost::vecS>;
 public:
@@ -158,17 +166,29 @@ private:
 } // namespace jla_boost
 namespace boost {
 
+template<template<typename> class Allocator, typename ValueType>
+struct container_gen<jla_boost::VecWithAllocatorS<Allocator>, ValueType> {
+	using type = std::vector<ValueType, Allocator<ValueType> >;
+};
+
+template<template<typename> class Allocator>
+struct parallel_edge_traits<jla_boost::VecWithAllocatorS<Allocator> > {
+	using type = allow_parallel_edge_tag;
+};
+
 // PropertyGraph
 //------------------------------------------------------------------------------
 
-template<typename DirectedS, typename VertexProperty, typename EdgeProperty, typename GraphProperty, typename Property>
-struct property_map<jla_boost::EdgeIndexedAdjacencyList<DirectedS, VertexProperty, EdgeProperty, GraphProperty>, Property>
-: property_map<typename jla_boost::EdgeIndexedAdjacencyList<DirectedS, VertexProperty, EdgeProperty, GraphProperty>::GraphType, Property> {
+template<typename DirectedS, typename VertexProperty, typename EdgeProperty, typename GraphProperty, typename OutEdgeListS,
+		typename Property>
+struct property_map<jla_boost::EdgeIndexedAdjacencyList<DirectedS, VertexProperty, EdgeProperty, GraphProperty, OutEdgeListS>, Property>
+: property_map<typename jla_boost::EdgeIndexedAdjacencyList<DirectedS, VertexProperty, EdgeProperty, GraphProperty, OutEdgeListS>::GraphType, Property> {
 };
 
-template<typename DirectedS, typename VertexProperty, typename EdgeProperty, typename GraphProperty, typename Property>
-struct property_map<const jla_boost::EdgeIndexedAdjacencyList<DirectedS, VertexProperty, EdgeProperty, GraphProperty>, Property>
-: property_map<typename jla_boost::EdgeIndexedAdjacencyList<DirectedS, VertexProperty, EdgeProperty, GraphProperty>::GraphType, Property> {
+template<typename DirectedS, typename VertexProperty, typename EdgeProperty, typename GraphProperty, typename OutEdgeListS,
+		typename Property>
+struct property_map<const jla_boost::EdgeIndexedAdjacencyList<DirectedS, VertexProperty, EdgeProperty, GraphProperty, OutEdgeListS>, Property>
+: property_map<typename jla_boost::EdgeIndexedAdjacencyList<DirectedS, VertexProperty, EdgeProperty, GraphProperty, OutEdgeListS>::GraphType, Property> {
 };
 
 } // namespace boost
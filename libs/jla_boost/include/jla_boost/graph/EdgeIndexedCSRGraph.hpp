@@ -0,0 +1,389 @@
+#ifndef JLA_BOOST_GRAPH_EDGEINDEXEDCSRGRAPH_HPP
+#define JLA_BOOST_GRAPH_EDGEINDEXEDCSRGRAPH_HPP
+
+#include <boost/graph/graph_selectors.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/property_map/property_map.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// An undirected graph with the same interface and the same vertex and edge indices as
+// EdgeIndexedAdjacencyList<boost::undirectedS> without properties, but stored compactly.
+// The graph is built by add_vertex and add_edge, where the incidence lists are stored per vertex,
+// and freeze() then moves them into a single array in compressed sparse row (CSR) form,
+// i.e., one contiguous array of incidences and an array with the offset for each vertex.
+// Adding vertices or edges to a frozen graph is possible, but makes it unfrozen.
+
+namespace jla_boost {
+
+template<typename DirectedS>
+struct EdgeIndexedCSRGraph {
+	static_assert(std::is_same<DirectedS, boost::undirectedS>::value, "Only undirected graphs are implemented.");
+	using Self = EdgeIndexedCSRGraph;
+private:
+	using Index = std::uint32_t;
+
+	struct Incidence {
+		Index target, edgeId;
+	};
+
+	struct StoredEdge {
+		Index source, target;
+	};
+public: // Graph
+	using vertex_descriptor = std::size_t;
+
+	struct edge_descriptor {
+		edge_descriptor() = default;
+
+		edge_descriptor(vertex_descriptor src, vertex_descriptor tar, std::size_t id) : src(src), tar(tar), id(id) { }
+
+		friend bool operator==(const edge_descriptor &a, const edge_descriptor &b) {
+			return a.id == b.id;
+		}
+
+		friend bool operator!=(const edge_descriptor &a, const edge_descriptor &b) {
+			return a.id != b.id;
+		}
+
+		friend bool operator<(const edge_descriptor &a, const edge_descriptor &b) {
+			return a.id < b.id;
+		}
+	public:
+		vertex_descriptor src = null_vertex(), tar = null_vertex();
+		std::size_t id = std::numeric_limits<std::size_t>::max();
+	};
+
+	using directed_category = boost::undirected_tag;
+	using edge_parallel_category = boost::allow_parallel_edge_tag;
+
+	struct traversal_category : boost::bidirectional_graph_tag, boost::adjacency_graph_tag,
+			boost::vertex_list_graph_tag, boost::edge_list_graph_tag {
+	};
+
+	static vertex_descriptor null_vertex() {
+		return std::numeric_limits<vertex_descriptor>::max();
+	}
+public:
+
+	EdgeIndexedCSRGraph() = default;
+
+	bool isFrozen() const {
+		return frozen;
+	}
+
+	// Moves the incidence lists into CSR form.
+	void freeze() {
+		if(frozen) return;
+		offsets.clear();
+		offsets.reserve(incidenceLists.size() + 1);
+		incidences.clear();
+		incidences.reserve(2 * edgeList.size());
+		offsets.push_back(0);
+		for(const auto &l : incidenceLists) {
+			incidences.insert(incidences.end(), l.begin(), l.end());
+			offsets.push_back(incidences.size());
+		}
+		incidenceLists = std::vector<std::vector<Incidence> >();
+		edgeList.shrink_to_fit();
+		frozen = true;
+	}
+private:
+
+	void thaw() {
+		assert(frozen);
+		const std::size_t n = offsets.size() - 1;
+		incidenceLists.resize(n);
+		for(std::size_t i = 0; i != n; ++i)
+			incidenceLists[i].assign(incidences.begin() + offsets[i], incidences.begin() + offsets[i + 1]);
+		offsets = std::vector<Index>();
+		incidences = std::vector<Incidence>();
+		frozen = false;
+	}
+
+	const Incidence *incidenceBegin(vertex_descriptor v) const {
+		return frozen ? incidences.data() + offsets[v] : incidenceLists[v].data();
+	}
+
+	const Incidence *incidenceEnd(vertex_descriptor v) const {
+		return frozen ? incidences.data() + offsets[v + 1] : incidenceLists[v].data() + incidenceLists[v].size();
+	}
+public: // IncidenceGraph
+	using degree_size_type = std::size_t;
+
+	// Reversed iterators give the edges with the vertex as target, as needed for in_edges.
+	template<bool Reversed>
+	struct IncidenceIterator
+	: boost::iterator_facade<IncidenceIterator<Reversed>, edge_descriptor, std::random_access_iterator_tag, edge_descriptor> {
+		IncidenceIterator() = default;
+
+		IncidenceIterator(vertex_descriptor v, const Incidence *iter) : v(v), iter(iter) { }
+	private:
+		friend class boost::iterator_core_access;
+
+		edge_descriptor dereference() const {
+			return Reversed ? edge_descriptor(iter->target, v, iter->edgeId) : edge_descriptor(v, iter->target, iter->edgeId);
+		}
+
+		bool equal(const IncidenceIterator &other) const {
+			return iter == other.iter;
+		}
+
+		void increment() {
+			++iter;
+		}
+
+		void decrement() {
+			--iter;
+		}
+
+		void advance(std::ptrdiff_t n) {
+			iter += n;
+		}
+
+		std::ptrdiff_t distance_to(const IncidenceIterator &other) const {
+			return other.iter - iter;
+		}
+	private:
+		vertex_descriptor v;
+		const Incidence *iter;
+	};
+
+	using out_edge_iterator = IncidenceIterator<false>;
+
+	friend std::pair<out_edge_iterator, out_edge_iterator> out_edges(vertex_descriptor v, const Self &g) {
+		assert(v < num_vertices(g));
+		return std::make_pair(out_edge_iterator(v, g.incidenceBegin(v)), out_edge_iterator(v, g.incidenceEnd(v)));
+	}
+
+	friend vertex_descriptor source(edge_descriptor e, const Self &) {
+		return e.src;
+	}
+
+	friend vertex_descriptor target(edge_descriptor e, const Self &) {
+		return e.tar;
+	}
+
+	friend degree_size_type out_degree(vertex_descriptor v, const Self &g) {
+		assert(v < num_vertices(g));
+		return g.incidenceEnd(v) - g.incidenceBegin(v);
+	}
+public: // BidirectionalGraph
+	using in_edge_iterator = IncidenceIterator<true>;
+
+	friend std::pair<in_edge_iterator, in_edge_iterator> in_edges(vertex_descriptor v, const Self &g) {
+		assert(v < num_vertices(g));
+		return std::make_pair(in_edge_iterator(v, g.incidenceBegin(v)), in_edge_iterator(v, g.incidenceEnd(v)));
+	}
+
+	friend degree_size_type in_degree(vertex_descriptor v, const Self &g) {
+		return out_degree(v, g);
+	}
+
+	friend degree_size_type degree(vertex_descriptor v, const Self &g) {
+		return out_degree(v, g);
+	}
+public: // AdjacencyGraph
+
+	struct adjacency_iterator
+	: boost::iterator_facade<adjacency_iterator, vertex_descriptor, std::random_access_iterator_tag, vertex_descriptor> {
+		adjacency_iterator() = default;
+
+		explicit adjacency_iterator(const Incidence *iter) : iter(iter) { }
+	private:
+		friend class boost::iterator_core_access;
+
+		vertex_descriptor dereference() const {
+			return iter->target;
+		}
+
+		bool equal(const adjacency_iterator &other) const {
+			return iter == other.iter;
+		}
+
+		void increment() {
+			++iter;
+		}
+
+		void decrement() {
+			--iter;
+		}
+
+		void advance(std::ptrdiff_t n) {
+			iter += n;
+		}
+
+		std::ptrdiff_t distance_to(const adjacency_iterator &other) const {
+			return other.iter - iter;
+		}
+	private:
+		const Incidence *iter;
+	};
+
+	friend std::pair<adjacency_iterator, adjacency_iterator> adjacent_vertices(vertex_descriptor v, const Self &g) {
+		assert(v < num_vertices(g));
+		return std::make_pair(adjacency_iterator(g.incidenceBegin(v)), adjacency_iterator(g.incidenceEnd(v)));
+	}
+public: // VertexListGraph
+	using vertex_iterator = boost::counting_iterator<vertex_descriptor>;
+	using vertices_size_type = std::size_t;
+
+	friend std::pair<vertex_iterator, vertex_iterator> vertices(const Self &g) {
+		return std::make_pair(vertex_iterator(0), vertex_iterator(num_vertices(g)));
+	}
+
+	friend vertices_size_type num_vertices(const Self &g) {
+		return g.frozen ? g.offsets.size() - 1 : g.incidenceLists.size();
+	}
+public: // EdgeListGraph
+	using edges_size_type = std::size_t;
+
+	// only forward traversal, as for adjacency_list, which union_graph relies on
+	struct edge_iterator
+	: boost::iterator_facade<edge_iterator, edge_descriptor, std::forward_iterator_tag, edge_descriptor> {
+		edge_iterator() = default;
+
+		edge_iterator(const Self *g, std::size_t id) : g(g), id(id) { }
+	private:
+		friend class boost::iterator_core_access;
+
+		edge_descriptor dereference() const {
+			const auto &e = g->edgeList[id];
+			return edge_descriptor(e.source, e.target, id);
+		}
+
+		bool equal(const edge_iterator &other) const {
+			return id == other.id;
+		}
+
+		void increment() {
+			++id;
+		}
+	private:
+		const Self *g;
+		std::size_t id;
+	};
+
+	friend std::pair<edge_iterator, edge_iterator> edges(const Self &g) {
+		return std::make_pair(edge_iterator(&g, 0), edge_iterator(&g, g.edgeList.size()));
+	}
+
+	friend edges_size_type num_edges(const Self &g) {
+		return g.edgeList.size();
+	}
+public: // "AdjacencyMatrix" (it's not constant time)
+
+	friend std::pair<edge_descriptor, bool> edge(vertex_descriptor u, vertex_descriptor v, const Self &g) {
+		for(auto iter = g.incidenceBegin(u), iterEnd = g.incidenceEnd(u); iter != iterEnd; ++iter)
+			if(iter->target == v) return std::make_pair(edge_descriptor(u, v, iter->edgeId), true);
+		return std::make_pair(edge_descriptor(), false);
+	}
+public: // MutableGraph
+
+	friend vertex_descriptor add_vertex(Self &g) {
+		if(g.frozen) g.thaw();
+		assert(g.incidenceLists.size() < std::numeric_limits<Index>::max());
+		g.incidenceLists.emplace_back();
+		return g.incidenceLists.size() - 1;
+	}
+
+	friend std::pair<edge_descriptor, bool> add_edge(vertex_descriptor u, vertex_descriptor v, Self &g) {
+		if(g.frozen) g.thaw();
+		assert(u < num_vertices(g));
+		assert(v < num_vertices(g));
+		assert(g.edgeList.size() < std::numeric_limits<Index>::max());
+		const Index eId = g.edgeList.size();
+		g.edgeList.push_back(StoredEdge{Index(u), Index(v)});
+		g.incidenceLists[u].push_back(Incidence{Index(v), eId});
+		g.incidenceLists[v].push_back(Incidence{Index(u), eId});
+		return std::make_pair(edge_descriptor(u, v, eId), true);
+	}
+public: // PropertyGraph
+	using VertexIndexMap = boost::typed_identity_property_map<vertex_descriptor>;
+
+	struct EdgeIndexMap {
+		using key_type = edge_descriptor;
+		using value_type = std::size_t;
+		using reference = std::size_t;
+		using category = boost::readable_property_map_tag;
+	public:
+
+		std::size_t operator[](edge_descriptor e) const {
+			return e.id;
+		}
+
+		friend std::size_t get(EdgeIndexMap, edge_descriptor e) {
+			return e.id;
+		}
+	};
+
+	friend VertexIndexMap get(boost::vertex_index_t, const Self &) {
+		return VertexIndexMap();
+	}
+
+	friend std::size_t get(boost::vertex_index_t, const Self &, vertex_descriptor v) {
+		return v;
+	}
+
+	friend EdgeIndexMap get(boost::edge_index_t, const Self &) {
+		return EdgeIndexMap();
+	}
+
+	friend std::size_t get(boost::edge_index_t, const Self &, edge_descriptor e) {
+		return e.id;
+	}
+public: // Other
+
+	friend vertex_descriptor vertex(vertices_size_type n, const Self &g) {
+		assert(n < num_vertices(g));
+		return n;
+	}
+private:
+	bool frozen = false;
+	// when not frozen
+	std::vector<std::vector<Incidence> > incidenceLists;
+	// when frozen, the incidences of vertex v are incidences[offsets[v]] to incidences[offsets[v + 1] - 1]
+	std::vector<Index> offsets;
+	std::vector<Incidence> incidences;
+	// indexed by the edge indices
+	std::vector<StoredEdge> edgeList;
+};
+
+} // namespace jla_boost
+namespace boost {
+
+// PropertyGraph
+//------------------------------------------------------------------------------
+
+template<typename DirectedS>
+struct property_map<jla_boost::EdgeIndexedCSRGraph<DirectedS>, vertex_index_t> {
+	using type = typename jla_boost::EdgeIndexedCSRGraph<DirectedS>::VertexIndexMap;
+	using const_type = type;
+};
+
+template<typename DirectedS>
+struct property_map<const jla_boost::EdgeIndexedCSRGraph<DirectedS>, vertex_index_t>
+: property_map<jla_boost::EdgeIndexedCSRGraph<DirectedS>, vertex_index_t> {
+};
+
+template<typename DirectedS>
+struct property_map<jla_boost::EdgeIndexedCSRGraph<DirectedS>, edge_index_t> {
+	using type = typename jla_boost::EdgeIndexedCSRGraph<DirectedS>::EdgeIndexMap;
+	using const_type = type;
+};
+
+template<typename DirectedS>
+struct property_map<const jla_boost::EdgeIndexedCSRGraph<DirectedS>, edge_index_t>
+: property_map<jla_boost::EdgeIndexedCSRGraph<DirectedS>, edge_index_t> {
+};
+
+} // namespace boost
+
+#endif /* JLA_BOOST_GRAPH_EDGEINDEXEDCSRGRAPH_HPP */
@@ -2,6 +2,7 @@
 #define JLA_BOOST_GRAPH_MORPHISM_PREDICATES_H
 
 // - PropertyPredicate
+// - Partial predicates
 
 namespace jla_boost {
 namespace GraphMorphism {
@@ -37,6 +38,37 @@ auto makePropertyPredicateEq(PropDomain &&pDomain, PropCodomain &&pCodomain, Nex
 	return makePropertyPredicate(std::equal_to<>(), std::forward<PropDomain>(pDomain), std::forward<PropCodomain>(pCodomain), next);
 }
 
+// Partial predicates
+//------------------------------------------------------------------------------
+// A vertex predicate may additionally have a member function
+//   bool partial(vDomain, vCodomain, const VertexMap &m, const GraphDomain &gDomain, const GraphCodomain &gCodomain) const
+// which finders extending a morphism one vertex at a time call when vDomain is about to be mapped to vCodomain.
+// The map m is the current partial morphism, where unmapped vertices have the null vertex as image.
+// Returning false prunes all extensions of m which map vDomain to vCodomain.
+
+namespace detail {
+
+template<typename Pred, typename VDomain, typename VCodomain, typename VertexMap, typename GraphDomain, typename GraphCodomain>
+auto partialPredicate(const Pred &pred, const VDomain &vDomain, const VCodomain &vCodomain, const VertexMap &m,
+		const GraphDomain &gDomain, const GraphCodomain &gCodomain, int)
+-> decltype(pred.partial(vDomain, vCodomain, m, gDomain, gCodomain)) {
+	return pred.partial(vDomain, vCodomain, m, gDomain, gCodomain);
+}
+
+template<typename Pred, typename VDomain, typename VCodomain, typename VertexMap, typename GraphDomain, typename GraphCodomain>
+bool partialPredicate(const Pred &pred, const VDomain &vDomain, const VCodomain &vCodomain, const VertexMap &m,
+		const GraphDomain &gDomain, const GraphCodomain &gCodomain, long) {
+	return true;
+}
+
+} // namespace detail
+
+template<typename Pred, typename VDomain, typename VCodomain, typename VertexMap, typename GraphDomain, typename GraphCodomain>
+bool partialPredicate(const Pred &pred, const VDomain &vDomain, const VCodomain &vCodomain, const VertexMap &m,
+		const GraphDomain &gDomain, const GraphCodomain &gCodomain) {
+	return detail::partialPredicate(pred, vDomain, vCodomain, m, gDomain, gCodomain, 0);
+}
+
 } // namespace GraphMorphism
 } // namespace jla_boost
 
@@ -5,6 +5,7 @@
 
 #include <jla_boost/Functional.hpp>
 #include <jla_boost/graph/PairToRangeAdaptor.hpp>
+#include <jla_boost/graph/morphism/Predicates.hpp>
 #include <jla_boost/graph/morphism/models/InvertibleAdaptor.hpp>
 #include <jla_boost/graph/morphism/models/Vector.hpp>
 
@@ -395,6 +396,7 @@ public:
 	bool feasible(const vertex1_type& v_new, const vertex2_type& w_new) {
 
 		if(!vertexPred(v_new, w_new)) return false;
+		if(!jla_boost::GraphMorphism::partialPredicate(vertexPred, v_new, w_new, stateDom.get_map(), gDom, gCodom)) return false;
 
 		// graph1
 		graph1_size_type term_in1_count = 0, term_out1_count = 0, rest1_count = 0;
@@ -19,6 +19,7 @@
 #include <boost/preprocessor/seq/transform.hpp>
 #include <boost/preprocessor/tuple/elem.hpp>
 
+#include <atomic>
 #include <limits>
 #include <string>
 
@@ -177,6 +178,34 @@ private:
 };
 // rst-class-end:
 
+// rst: The settings of type ``unsigned long`` are statistics counters,
+// rst: which may be incremented concurrently by the library, e.g., from several threads running strategies.
+// rst: They have the same interface, except that :cpp:func:`ConfigSetting::operator()` is replaced by ``increment(n)``.
+
+template<>
+struct ConfigSetting<unsigned long> {
+	ConfigSetting(unsigned long value, const std::string &name) : value(value), name(name) {}
+
+	void set(unsigned long value) {
+		this->value.store(value, std::memory_order_relaxed);
+	}
+
+	unsigned long get() const {
+		return value.load(std::memory_order_relaxed);
+	}
+
+	void increment(unsigned long n = 1) {
+		value.fetch_add(n, std::memory_order_relaxed);
+	}
+
+	const std::string &getName() const {
+		return name;
+	}
+private:
+	std::atomic<unsigned long> value;
+	const std::string name;
+};
+
 // rst-class: Config
 // rst:
 // rst:		Holds all configuration settings.
@@ -222,6 +251,13 @@ struct Config {
         ((bool, derivationDebugOutput, false))                                      \
         ((bool, ignoreSubset, false))                                               \
         ((bool, disableRepeatFixedPointCheck, false))                               \
+        ((bool, semiNaiveRepeat, false))                                            \
+        ((bool, useCompositionCache, false))                                        \
+        ((bool, useRuleArena, true))                                                \
+        ((bool, pruneSymmetricMatches, false))                                      \
+        ((bool, canonicaliseProducts, true))                                        \
+        ((unsigned long, numRuleArenaAllocations, 0))                               \
+        ((unsigned long, numRuleArenaBlocks, 0))                                    \
         ((bool, useDotCoords, false))                                               \
         ((std::string, graphvizCoordsBegin, ""))                                    \
         ((std::string, tikzPictureOption, "scale=\\modDGHyperScale"))               \
@@ -237,6 +273,11 @@ struct Config {
         ((mod::Config::IsomorphismAlg, isomorphismAlg, mod::Config::IsomorphismAlg::VF2)) \
         ((bool, useWrongSmilesCanonAlg, false))                                     \
         ((unsigned long, numIsomorphismCalls, 0))                                   \
+        ((unsigned long, numCollectionHits, 0))                                     \
+        ((unsigned long, numCollectionMisses, 0))                                   \
+        ((unsigned long, numCollectionConfirmations, 0))                            \
+        ((unsigned long, numInvariantRejects, 0))                                   \
+        ((unsigned long, numVF2Calls, 0))                                           \
     ))                                                                              \
     ((IO, io,                                                                       \
         ((std::string, dotCoordOptions, ""))                                        \
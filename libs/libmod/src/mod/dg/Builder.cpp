@@ -10,9 +10,22 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <fstream>
+#include <ostream>
+
 namespace mod {
 namespace dg {
 
+std::ostream &operator<<(std::ostream &s, RuleApplicationEngine engine) {
+	switch(engine) {
+	case RuleApplicationEngine::Composition:
+		return s << "composition";
+	case RuleApplicationEngine::Direct:
+		return s << "direct";
+	}
+	return s;
+}
+
 struct Builder::Pimpl {
 	Pimpl(std::shared_ptr<DG> dg_, lib::DG::NonHyperBuilder &dgLib) : dg_(dg_), b(dgLib.build()) {}
 public:
@@ -61,9 +74,14 @@ ExecuteResult Builder::execute(std::shared_ptr<Strategy> strategy, int verbosity
 }
 
 ExecuteResult Builder::execute(std::shared_ptr<Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes) {
+	return execute(strategy, verbosity, ignoreRuleLabelTypes, RuleApplicationEngine::Composition);
+}
+
+ExecuteResult Builder::execute(std::shared_ptr<Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes,
+                               RuleApplicationEngine engine) {
 	check(p);
 	auto res = p->b.execute(std::unique_ptr<lib::DG::Strategies::Strategy>(strategy->getStrategy().clone()),
-	                        verbosity, ignoreRuleLabelTypes);
+	                        verbosity, ignoreRuleLabelTypes, engine);
 	return ExecuteResult(p->dg_, std::move(res));
 }
 
@@ -72,6 +90,14 @@ void Builder::addAbstract(const std::string &description) {
 	p->b.addAbstract(description);
 }
 
+void Builder::load(const std::vector<std::shared_ptr<rule::Rule>> &ruleDatabase, const std::string &file, int verbosity) {
+	check(p);
+	std::ifstream fileStream(file.c_str());
+	if(!fileStream.is_open()) throw InputError("DG dump file not found, '" + file + "'\n");
+	fileStream.close();
+	p->b.load(ruleDatabase, file, verbosity);
+}
+
 // -----------------------------------------------------------------------------
 
 struct ExecuteResult::Pimpl {
@@ -109,6 +135,10 @@ const std::vector<std::shared_ptr<graph::Graph>> &ExecuteResult::getUniverse() c
 	return p->universe;
 }
 
+const ExecuteStatistics &ExecuteResult::getStatistics() const {
+	return p->res.getStatistics();
+}
+
 void ExecuteResult::list(bool withUniverse) const {
 	p->res.list(withUniverse);
 }
@@ -2,9 +2,11 @@
 #define MOD_DG_BUILDER_H
 
 #include <mod/BuildConfig.hpp>
+#include <mod/dg/ExecuteStatistics.hpp>
 #include <mod/dg/ForwardDecl.hpp>
 #include <mod/dg/GraphInterface.hpp>
 
+#include <iosfwd>
 #include <memory>
 
 namespace mod {
@@ -16,6 +18,29 @@ struct ExecuteResult;
 } // namespace lib
 namespace dg {
 
+// rst: .. enum-struct:: RuleApplicationEngine
+// rst:
+// rst:		The method used by :cpp:func:`Builder::execute` for applying the rules of rule strategies.
+// rst:
+enum class RuleApplicationEngine {
+	// rst:		.. enumerator:: Composition
+	// rst:
+	// rst:			Each rule is applied by composing it with the bind rules of the graphs,
+	// rst:			one connected component of the left side at a time.
+	// rst:			This is the default.
+	Composition,
+	// rst:		.. enumerator:: Direct
+	// rst:
+	// rst:			Each rule is applied by matching all connected components of the left side directly into the graphs,
+	// rst:			and then rewriting a copy of the matched graphs, without creating any intermediary rules.
+	// rst:			This gives the same derivations as :enumerator:`Composition`,
+	// rst:			though the products may be found in a different order.
+	// rst:			It is only used when the derivation graph has :enumerator:`LabelType::String` without stereo information,
+	// rst:			and otherwise :enumerator:`Composition` is used.
+	Direct
+};
+MOD_DECL std::ostream &operator<<(std::ostream &s, RuleApplicationEngine engine);
+
 // rst-class: dg::Builder
 // rst:
 // rst:		An RAII-style object obtained from :cpp:func:`DG::build`.
@@ -57,9 +82,13 @@ public:
 	// rst: .. function:: ExecuteResult execute(std::shared_ptr<Strategy> strategy)
 	// rst:               ExecuteResult execute(std::shared_ptr<Strategy> strategy, int verbosity)
 	// rst:               ExecuteResult execute(std::shared_ptr<Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes)
+	// rst:               ExecuteResult execute(std::shared_ptr<Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes, \
+	// rst:                                     RuleApplicationEngine engine)
 	// rst:
 	// rst:		Execute the given strategy (:ref:`dgStrat`) and as a side-effect add
 	// rst:		vertices and hyperedges to the underlying derivation graph.
+	// rst:		The rules are applied with the given :cpp:var:`engine`,
+	// rst:		which defaults to :enumerator:`RuleApplicationEngine::Composition`.
 	// rst:
 	// rst:		The :cpp:var:`verbosity` defaults to level 2.
 	// rst:		The levels have the following meaning:
@@ -87,6 +116,8 @@ public:
 	ExecuteResult execute(std::shared_ptr<Strategy> strategy);
 	ExecuteResult execute(std::shared_ptr<Strategy> strategy, int verbosity);
 	ExecuteResult execute(std::shared_ptr<Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes);
+	ExecuteResult execute(std::shared_ptr<Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes,
+	                      RuleApplicationEngine engine);
 	// rst: .. function:: void addAbstract(const std::string &description)
 	// rst:
 	// rst:		Add vertices and hyperedges based on the given abstract description.
@@ -97,6 +128,20 @@ public:
 	// rst:
 	// rst:		:throws: :class:`InputError` if the description could not be parsed.
 	void addAbstract(const std::string &description);
+	// rst: .. function:: void load(const std::vector<std::shared_ptr<rule::Rule>> &ruleDatabase, \
+	// rst:                         const std::string &file, int verbosity)
+	// rst:
+	// rst:		Load and add a derivation graph dump, e.g., to resume an interrupted or extended computation.
+	// rst:		Both the text format from :cpp:func:`DG::dump` and the binary format from :cpp:func:`DG::dumpBinary`
+	// rst:		are accepted.
+	// rst:		Any graph in the dump which is isomorphic to a graph already in the derivation graph is replaced by that graph.
+	// rst:		The rules of the dump are looked up by name in :cpp:var:`ruleDatabase`.
+	// rst:		With a :cpp:var:`verbosity` of at least 2, the linking of graphs and rules is printed.
+	// rst:
+	// rst:		:throws: :class:`LogicError` if `!isActive()`.
+	// rst:		:throws: :class:`InputError` if the file can not be opened or parsed,
+	// rst:			or if a rule of the dump is not in :cpp:var:`ruleDatabase`.
+	void load(const std::vector<std::shared_ptr<rule::Rule>> &ruleDatabase, const std::string &file, int verbosity);
 private:
 	struct Pimpl;
 	std::unique_ptr<Pimpl> p;
@@ -121,6 +166,10 @@ public:
 	// rst:		:returns: respectively the subset and the universe computed by the strategy execution (see also :ref:`dgStrat`).
 	const std::vector<std::shared_ptr<graph::Graph>> &getSubset() const;
 	const std::vector<std::shared_ptr<graph::Graph>> &getUniverse() const;
+	// rst: .. function:: const ExecuteStatistics &getStatistics() const
+	// rst:
+	// rst:		:returns: the counters and timers collected during the execution.
+	const ExecuteStatistics &getStatistics() const;
 	// rst: .. function:: void list(bool withUniverse) const
 	// rst:
 	// rst:		Output information from the execution of the strategy.
@@ -187,6 +187,12 @@ std::string DG::dump() const {
 	else return lib::IO::DG::Write::dump(*p->dg);
 }
 
+std::string DG::dumpBinary() const {
+	if(!p->dg->getHasCalculated())
+		throw LogicError("No dump can be done before the derivation graph it has been calculated.\n");
+	else return lib::IO::DG::Write::dumpBinary(*p->dg);
+}
+
 void DG::listStats() const {
 	if(!p->dg->getHasCalculated()) throw LogicError("No stats can be printed before calculation.\n");
 	else p->dg->getHyper().printStats(lib::IO::log());
@@ -144,6 +144,17 @@ public:
 	// rst:		:returns: the name of the file with the exported data.
 	// rst:		:throws: :class:`LogicError` if the DG has not been calculated.
 	std::string dump() const;
+	// rst: .. function:: std::string dumpBinary() const
+	// rst:
+	// rst:		Exports the derivation graph to a binary file, which can be imported like the text format.
+	// rst:		Along with each graph the key used by the graph database is stored,
+	// rst:		so importing into a derivation graph with the same label settings and
+	// rst:		isomorphism algorithm (``getConfig().graph.isomorphismAlg``) skips recomputing it.
+	// rst:		The file is not portable between machines with different byte order.
+	// rst:
+	// rst:		:returns: the name of the file with the exported data.
+	// rst:		:throws: :class:`LogicError` if the DG has not been calculated.
+	std::string dumpBinary() const;
 	// rst: .. function:: void listStats() const
 	// rst: 
 	// rst:		Output various stats of the derivation graph.
@@ -181,6 +192,7 @@ public:
 	// rst:
 	// rst: 		Load a derivation graph dump. Any graph in the dump which is isomorphic to a given graph is replaced by the given graph.
 	// rst: 		The same procedure is done for the rules, however only using the name of the rule for comparison.
+	// rst: 		Both the text format from :cpp:func:`dump` and the binary format from :cpp:func:`dumpBinary` are accepted.
 	// rst:
 	// rst: 		:throws: :class:`InputError` on bad input.
 	static std::shared_ptr<DG> dumpImport(const std::vector<std::shared_ptr<graph::Graph> > &graphs,
@@ -0,0 +1,93 @@
+#include "ExecuteStatistics.hpp"
+
+#include <mod/rule/Rule.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+namespace mod {
+namespace dg {
+namespace {
+
+void printString(std::ostream &s, const std::string &str) {
+	s << '"';
+	for(const char c : str) {
+		switch(c) {
+		case '"': s << "\\\"";
+			break;
+		case '\\': s << "\\\\";
+			break;
+		case '\n': s << "\\n";
+			break;
+		case '\t': s << "\\t";
+			break;
+		default:
+			if(static_cast<unsigned char>(c) < 0x20)
+				s << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec << std::setfill(' ');
+			else s << c;
+		}
+	}
+	s << '"';
+}
+
+} // namespace
+
+void ExecuteStatistics::RuleStatistics::add(const RuleStatistics &other) {
+	executions += other.executions;
+	bindingsTried += other.bindingsTried;
+	compositions += other.compositions;
+	symmetricMatchesPruned += other.symmetricMatchesPruned;
+	derivations += other.derivations;
+	leftPredicateRejections += other.leftPredicateRejections;
+	rightPredicateRejections += other.rightPredicateRejections;
+	productsNew += other.productsNew;
+	productsDuplicate += other.productsDuplicate;
+	bindingTime += other.bindingTime;
+	time += other.time;
+}
+
+std::string ExecuteStatistics::toJSON() const {
+	std::ostringstream s;
+	s << std::setprecision(9);
+	s << "{\n";
+	s << "\t\"time\": " << time << ",\n";
+	s << "\t\"isomorphismCalls\": " << isomorphismCalls << ",\n";
+	s << "\t\"productLookupTime\": " << productLookupTime << ",\n";
+	s << "\t\"rules\": [";
+	bool first = true;
+	for(const RuleStatistics &r : rules) {
+		s << (first ? "\n" : ",\n");
+		first = false;
+		s << "\t\t{\"rule\": ";
+		printString(s, r.rule ? r.rule->getName() : std::string());
+		s << ", \"id\": " << (r.rule ? r.rule->getId() : 0)
+		  << ", \"executions\": " << r.executions
+		  << ", \"bindingsTried\": " << r.bindingsTried
+		  << ", \"compositions\": " << r.compositions
+		  << ", \"symmetricMatchesPruned\": " << r.symmetricMatchesPruned
+		  << ", \"derivations\": " << r.derivations
+		  << ", \"leftPredicateRejections\": " << r.leftPredicateRejections
+		  << ", \"rightPredicateRejections\": " << r.rightPredicateRejections
+		  << ", \"productsNew\": " << r.productsNew
+		  << ", \"productsDuplicate\": " << r.productsDuplicate
+		  << ", \"bindingTime\": " << r.bindingTime
+		  << ", \"time\": " << r.time << "}";
+	}
+	s << (rules.empty() ? "],\n" : "\n\t],\n");
+	s << "\t\"strategies\": [";
+	first = true;
+	for(const StrategyStatistics &strat : strategies) {
+		s << (first ? "\n" : ",\n");
+		first = false;
+		s << "\t\t{\"kind\": ";
+		printString(s, strat.kind);
+		s << ", \"executions\": " << strat.executions
+		  << ", \"time\": " << strat.time << "}";
+	}
+	s << (strategies.empty() ? "]\n" : "\n\t]\n");
+	s << "}\n";
+	return s.str();
+}
+
+} // namespace dg
+} // namespace mod
@@ -0,0 +1,132 @@
+#ifndef MOD_DG_EXECUTESTATISTICS_H
+#define MOD_DG_EXECUTESTATISTICS_H
+
+#include <mod/BuildConfig.hpp>
+#include <mod/rule/ForwardDecl.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mod {
+namespace dg {
+
+// rst-class: dg::ExecuteStatistics
+// rst:
+// rst:		Counters and wall-clock timers collected during a call to :cpp:func:`Builder::execute`,
+// rst:		e.g., for finding the rules which dominate a long computation.
+// rst:		All times are in seconds.
+// rst:
+// rst-class-start:
+struct MOD_DECL ExecuteStatistics {
+	// rst-nested: dg::ExecuteStatistics::RuleStatistics
+	// rst:
+	// rst:		The statistics for all :ref:`strat-rule` strategies with the same rule.
+	// rst:
+	// rst-nested-start:
+	struct MOD_DECL RuleStatistics {
+		// rst:		.. member:: std::shared_ptr<rule::Rule> rule
+		std::shared_ptr<rule::Rule> rule;
+		// rst:		.. member:: std::size_t executions
+		// rst:
+		// rst:			The number of times a strategy with the rule was executed.
+		std::size_t executions = 0;
+		// rst:		.. member:: std::size_t bindingsTried
+		// rst:
+		// rst:			The number of times a graph was bound to a (partially bound) version of the rule.
+		std::size_t bindingsTried = 0;
+		// rst:		.. member:: std::size_t compositions
+		// rst:
+		// rst:			The number of (partially bound) rules resulting from the bindings, after duplicate removal.
+		// rst:
+		// rst:			With :enumerator:`RuleApplicationEngine::Direct`, these two counters are instead respectively
+		// rst:			the number of times a connected component of the left side was matched into a graph,
+		// rst:			and the number of complete matches of the left side.
+		std::size_t compositions = 0;
+		// rst:		.. member:: std::size_t symmetricMatchesPruned
+		// rst:
+		// rst:			The number of matches skipped during the bindings because an automorphism of the graph
+		// rst:			maps them to another match, see ``config.dg.pruneSymmetricMatches``.
+		std::size_t symmetricMatchesPruned = 0;
+		// rst:		.. member:: std::size_t derivations
+		// rst:
+		// rst:			The number of fully bound rules, i.e., the number of candidate derivations.
+		std::size_t derivations = 0;
+		// rst:		.. member:: std::size_t leftPredicateRejections
+		// rst:		            std::size_t rightPredicateRejections
+		// rst:
+		// rst:			The number of candidate derivations rejected by respectively
+		// rst:			a :ref:`strat-leftPredicate` and a :ref:`strat-rightPredicate`.
+		std::size_t leftPredicateRejections = 0, rightPredicateRejections = 0;
+		// rst:		.. member:: std::size_t productsNew
+		// rst:		            std::size_t productsDuplicate
+		// rst:
+		// rst:			The number of products of accepted derivations which respectively
+		// rst:			were new and already were products in the derivation graph.
+		std::size_t productsNew = 0, productsDuplicate = 0;
+		// rst:		.. member:: double bindingTime
+		// rst:
+		// rst:			The time spent on binding graphs, summed over all threads.
+		double bindingTime = 0;
+		// rst:		.. member:: double time
+		// rst:
+		// rst:			The time spent in the strategies.
+		double time = 0;
+	public:
+		void add(const RuleStatistics &other);
+	};
+	// rst-nested-end:
+
+	// rst-nested: dg::ExecuteStatistics::StrategyStatistics
+	// rst:
+	// rst:		The statistics for all strategies of the same kind, e.g., all :ref:`strat-repeat` strategies.
+	// rst:
+	// rst-nested-start:
+	struct MOD_DECL StrategyStatistics {
+		// rst:		.. member:: std::string kind
+		// rst:
+		// rst:			The kind of strategy, e.g., ``"Repeat"`` or ``"Rule"``.
+		std::string kind;
+		// rst:		.. member:: std::size_t executions
+		std::size_t executions = 0;
+		// rst:		.. member:: double time
+		// rst:
+		// rst:			The time spent in the strategies, including the time spent in their substrategies.
+		double time = 0;
+	};
+	// rst-nested-end:
+public:
+	// rst: .. function:: std::string toJSON() const
+	// rst:
+	// rst:		:returns: the statistics as a JSON object.
+	std::string toJSON() const;
+public:
+	// rst: .. member:: double time
+	// rst:
+	// rst:		The time spent in the execution.
+	double time = 0;
+	// rst: .. member:: std::size_t isomorphismCalls
+	// rst:
+	// rst:		The number of graph isomorphism checks performed during the execution, as counted by ``config.graph.numIsomorphismCalls``,
+	// rst:		but excluding the checks done concurrently by other threads, e.g., other executions.
+	std::size_t isomorphismCalls = 0;
+	// rst: .. member:: double productLookupTime
+	// rst:
+	// rst:		The time spent on looking up products in the graph database, which is mostly isomorphism checks.
+	double productLookupTime = 0;
+	// rst: .. member:: std::vector<RuleStatistics> rules
+	// rst:
+	// rst:		The statistics for each rule, in the order they were first executed.
+	std::vector<RuleStatistics> rules;
+	// rst: .. member:: std::vector<StrategyStatistics> strategies
+	// rst:
+	// rst:		The statistics for each kind of strategy, in the order they were first executed.
+	std::vector<StrategyStatistics> strategies;
+};
+// rst-class-end:
+
+} // namespace dg
+} // namespace mod
+
+#endif /* MOD_DG_EXECUTESTATISTICS_H */
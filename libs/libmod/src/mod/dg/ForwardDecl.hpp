@@ -6,6 +6,7 @@ namespace dg {
 struct Builder;
 struct DG;
 struct ExecuteResult;
+struct ExecuteStatistics;
 struct PrintData;
 struct Printer;
 struct Strategy;
@@ -98,6 +98,13 @@ std::shared_ptr<Strategy> Strategy::makeAdd(
 			new Strategy(std::make_unique<lib::DG::Strategies::Add>(generator, onlyUniverse, graphPolicy)));
 }
 
+std::shared_ptr<Strategy>
+Strategy::makeAdd(bool onlyUniverse, const std::vector<std::shared_ptr<graph::LazyGraph> > &graphs,
+                  const std::vector<std::shared_ptr<rule::Rule> > &rules, IsomorphismPolicy graphPolicy) {
+	return std::shared_ptr<Strategy>(
+			new Strategy(std::make_unique<lib::DG::Strategies::Add>(graphs, rules, onlyUniverse, graphPolicy)));
+}
+
 std::shared_ptr<Strategy>
 Strategy::makeExecute(std::shared_ptr<mod::Function<void(const Strategy::GraphState &)> > func) {
 	return std::shared_ptr<Strategy>(new Strategy(std::make_unique<lib::DG::Strategies::Execute>(func)));
@@ -111,6 +118,14 @@ std::shared_ptr<Strategy> Strategy::makeFilter(bool alsoUniverse,
 			new Strategy(std::make_unique<lib::DG::Strategies::Filter>(filterFunc, alsoUniverse)));
 }
 
+std::shared_ptr<Strategy> Strategy::makeFilterBatch(bool alsoUniverse,
+                                                    std::shared_ptr<mod::Function<std::vector<bool>(
+                                                          const std::vector<std::shared_ptr<graph::Graph> > &,
+                                                          const Strategy::GraphState &)> > filterFunc) {
+	return std::shared_ptr<Strategy>(
+			new Strategy(std::make_unique<lib::DG::Strategies::Filter>(filterFunc, alsoUniverse)));
+}
+
 std::shared_ptr<Strategy>
 Strategy::makeLeftPredicate(std::shared_ptr<mod::Function<bool(const mod::Derivation &)> > predicate,
                             std::shared_ptr<Strategy> strat) {
@@ -163,6 +178,11 @@ std::shared_ptr<Strategy> Strategy::makeSort(bool doUniverse,
 	return std::shared_ptr<Strategy>(new Strategy(std::make_unique<lib::DG::Strategies::Sort>(less, doUniverse)));
 }
 
+std::shared_ptr<Strategy> Strategy::makeSortByKey(bool doUniverse,
+                                                  std::shared_ptr<mod::Function<double(std::shared_ptr<graph::Graph>)> > key) {
+	return std::shared_ptr<Strategy>(new Strategy(std::make_unique<lib::DG::Strategies::Sort>(key, doUniverse)));
+}
+
 std::shared_ptr<Strategy> Strategy::makeTake(bool doUniverse, unsigned int limit) {
 	return std::shared_ptr<Strategy>(new Strategy(std::make_unique<lib::DG::Strategies::Take>(limit, doUniverse)));
 }
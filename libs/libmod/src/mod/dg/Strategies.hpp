@@ -76,6 +76,18 @@ public:
 	static std::shared_ptr<Strategy>
 	makeAdd(bool onlyUniverse, const std::shared_ptr<Function<std::vector<std::shared_ptr<graph::Graph>>()>> generator,
 	        IsomorphismPolicy graphPolicy);
+	// rst: .. function:: static std::shared_ptr<Strategy> \
+	// rst:               makeAdd(bool onlyUniverse, const std::vector<std::shared_ptr<graph::LazyGraph>> &graphs, \
+	// rst:                       const std::vector<std::shared_ptr<rule::Rule>> &rules, IsomorphismPolicy graphPolicy)
+	// rst:
+	// rst:		:returns: an :ref:`strat-addUniverse` strategy if `onlyUniverse` is `true`, otherwise an :ref:`strat-addSubset` strategy.
+	// rst:			The `graphPolicy` refers to the checking of each added graph against the internal graph database.
+	// rst:			When executed, only the lazy graphs which may match at least one of the given rules are loaded and added,
+	// rst:			see :cpp:func:`graph::LazyGraph::mayMatch`. If `rules` is empty, all graphs are loaded and added.
+	// rst:			After the execution each of the handles is released, and the derivation graph holds the loaded graphs.
+	static std::shared_ptr<Strategy>
+	makeAdd(bool onlyUniverse, const std::vector<std::shared_ptr<graph::LazyGraph>> &graphs,
+	        const std::vector<std::shared_ptr<rule::Rule>> &rules, IsomorphismPolicy graphPolicy);
 	// rst: .. function:: static std::shared_ptr<Strategy> makeExecute(std::shared_ptr<Function<void(const Strategy::GraphState&)> > func)
 	// rst:
 	// rst:		:returns: an :ref:`strat-execute` strategy.
@@ -91,6 +103,18 @@ public:
 	                                            std::shared_ptr<Function<bool(std::shared_ptr<graph::Graph>,
 	                                                                          const Strategy::GraphState &,
 	                                                                          bool)>> filterFunc);
+	// rst: .. function:: static std::shared_ptr<Strategy> makeFilterBatch(bool alsoUniverse, std::shared_ptr<Function<std::vector<bool>(const std::vector<std::shared_ptr<graph::Graph> >&, const Strategy::GraphState&)>> filterFunc)
+	// rst:
+	// rst:		As :func:`makeFilter`, but the predicate is called only once, with all the graphs of either the subset or the universe,
+	// rst:		and with the graph state. It must return whether to keep each of the graphs, in the same order.
+	// rst:		This is much faster than :func:`makeFilter` when the predicate is a Python function and the state is large.
+	// rst:
+	// rst:		:returns: a :ref:`strat-filterUniverse` strategy if `alsoUniverse` is `true`, otherwise a :ref:`strat-filterSubset` strategy.
+	// rst:		:throws: :class:`LogicError` during evaluation if the predicate does not return exactly one value for each graph.
+	static std::shared_ptr<Strategy> makeFilterBatch(bool alsoUniverse,
+	                                                 std::shared_ptr<Function<std::vector<bool>(
+	                                                       const std::vector<std::shared_ptr<graph::Graph> > &,
+	                                                       const Strategy::GraphState &)>> filterFunc);
 	// rst: .. function:: static std::shared_ptr<Strategy> makeLeftPredicate(std::shared_ptr<Function<bool(const Derivation&)>> predicate, std::shared_ptr<Strategy> strat)
 	// rst:
 	// rst:		Even though the predicate is called with a :class:`Derivation` object, only the left side and the rule of the object is valid.
@@ -130,6 +154,14 @@ public:
 	                                          std::shared_ptr<Function<bool(std::shared_ptr<graph::Graph>,
 	                                                                        std::shared_ptr<graph::Graph>,
 	                                                                        const Strategy::GraphState &)> > less);
+	// rst: .. function:: static std::shared_ptr<Strategy> makeSortByKey(bool doUniverse, std::shared_ptr<Function<double(std::shared_ptr<graph::Graph>)>> key)
+	// rst:
+	// rst:		The key function is called once for each graph in either the subset or the universe,
+	// rst:		and the graphs are then stably sorted in increasing order of their keys. Graphs with a NaN key are placed last.
+	// rst:
+	// rst:		:returns: a :ref:`strat-sort` strategy.
+	static std::shared_ptr<Strategy> makeSortByKey(bool doUniverse,
+	                                               std::shared_ptr<Function<double(std::shared_ptr<graph::Graph>)> > key);
 	// TODO: remove
 	static std::shared_ptr<Strategy> makeTake(bool doUniverse, unsigned int limit);
 };
@@ -5,10 +5,12 @@ namespace mod {
 namespace graph {
 struct Graph;
 struct GraphLess;
+struct LazyGraph;
 struct Printer;
 } // namespace graph
 namespace lib {
 namespace Graph {
+struct LabelSummary;
 struct Single;
 } // namespace Graph
 namespace IO {
@@ -299,5 +299,25 @@ std::shared_ptr<Graph> Graph::makeGraph(std::unique_ptr<lib::Graph::Single> g, s
 	return wrapped;
 }
 
+void Graph::precompute(const std::vector<std::shared_ptr<Graph> > &graphs, LabelSettings labelSettings) {
+	std::vector<const lib::Graph::Single *> gs;
+	gs.reserve(graphs.size());
+	for(const auto &g : graphs) {
+		if(!g) throw LogicError("Can not precompute a null graph.");
+		gs.push_back(&g->getGraph());
+	}
+	lib::Graph::precompute(gs, labelSettings);
+}
+
+void Graph::canonicalise(const std::vector<std::shared_ptr<Graph> > &graphs) {
+	std::vector<const lib::Graph::Single *> gs;
+	gs.reserve(graphs.size());
+	for(const auto &g : graphs) {
+		if(!g) throw LogicError("Can not canonicalise a null graph.");
+		gs.push_back(&g->getGraph());
+	}
+	lib::Graph::canonicalise(gs);
+}
+
 } // namespace graph
 } // namespace mod
\ No newline at end of file
@@ -261,6 +261,28 @@ public:
 	// rst:		:returns: a graph wrapping the given internal graph object. If an id mapping is given, it will be used for the :cpp:func:`getVertexFromExternalId` function.
 	static std::shared_ptr<Graph> makeGraph(std::unique_ptr<lib::Graph::Single> g);
 	static std::shared_ptr<Graph> makeGraph(std::unique_ptr<lib::Graph::Single> g, std::map<int, std::size_t> externalToInternalIds);
+	// rst: .. function:: static void precompute(const std::vector<std::shared_ptr<Graph> > &graphs, LabelSettings labelSettings)
+	// rst:
+	// rst:		Compute the data of the given graphs which rule application and isomorphism checks with the given label settings
+	// rst:		otherwise compute on first use, e.g., the molecule state, invariants, and the canonical form if needed.
+	// rst:		The graphs are processed in parallel with ``config.common.numThreads`` threads.
+	// rst:		The lazily computed data of graphs may in general be accessed concurrently,
+	// rst:		so this function is only needed for warming the graphs in bulk, e.g., before a derivation graph is built.
+	// rst:
+	// rst:		:throws: :class:`StereoDeductionError` if stereo data is needed but its deduction failed for a graph.
+	static void precompute(const std::vector<std::shared_ptr<Graph> > &graphs, LabelSettings labelSettings);
+	// rst: .. function:: static void canonicalise(const std::vector<std::shared_ptr<Graph> > &graphs)
+	// rst:
+	// rst:		Compute the canonical forms, the canonical SMILES strings, and the GraphDFS strings of the given graphs,
+	// rst:		in parallel with ``config.common.numThreads`` threads.
+	// rst:		The graphs are not modified, but the results are cached,
+	// rst:		so later calls to e.g. :cpp:func:`getSmiles` and :cpp:func:`getGraphDFS`, and isomorphism checks
+	// rst:		using the canonical forms, do not compute them one graph at a time.
+	// rst:		Canonical forms are only computed for graphs which can be canonicalised, and SMILES strings only for molecules.
+	// rst:
+	// rst:		See also ``config.dg.canonicaliseProducts``, which makes :cpp:func:`dg::Builder::execute` compute
+	// rst:		the part of this which ``config.graph.isomorphismAlg`` uses for the new products.
+	static void canonicalise(const std::vector<std::shared_ptr<Graph> > &graphs);
 };
 // rst-class-end:
 
@@ -0,0 +1,174 @@
+#include "LazyGraph.hpp"
+
+#include <mod/Error.hpp>
+#include <mod/graph/Graph.hpp>
+#include <mod/rule/Rule.hpp>
+#include <mod/lib/Graph/LabelSummary.hpp>
+#include <mod/lib/Graph/Properties/String.hpp>
+#include <mod/lib/IO/Graph.hpp>
+
+#include <boost/graph/connected_components.hpp>
+#include <boost/optional.hpp>
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace mod {
+namespace graph {
+
+struct LazyGraph::Pimpl {
+	enum class Format {
+		GMLString, GMLFile, DFS, SMILES
+	};
+public:
+	Pimpl(Format format, std::string data) : format(format), data(std::move(data)) {}
+
+	// Parses the data and summarises it, without creating a Graph, so no graph id or name is used.
+	// The checks match those of the Graph constructors.
+	lib::Graph::LabelSummary summarise() const {
+		std::ostringstream err;
+		std::string source;
+		const auto gData = parse(source, err);
+		if(!gData.g)
+			throw InputError("Error in graph loading from " + source + ".\n" + err.str());
+		std::vector<std::size_t> cMap(num_vertices(*gData.g));
+		const auto numComponents = boost::connected_components(*gData.g, cMap.data());
+		if(numComponents > 1)
+			throw InputError("Error in graph loading from " + source
+			                 + ".\nThe graph is not connected (" + std::to_string(numComponents) + " components).");
+		return lib::Graph::LabelSummary::make(*gData.g, *gData.pString);
+	}
+
+	lib::IO::Graph::Read::Data parse(std::string &source, std::ostringstream &err) const {
+		switch(format) {
+		case Format::GMLString: {
+			source = "inline GML string";
+			std::istringstream ss(data);
+			return lib::IO::Graph::Read::gml(ss, err);
+		}
+		case Format::GMLFile: {
+			source = "file, '" + data + "'";
+			std::ifstream ifs(data);
+			if(!ifs) throw InputError("Could not open graph GML file '" + data + "'.\n");
+			return lib::IO::Graph::Read::gml(ifs, err);
+		}
+		case Format::DFS:
+			source = "graphDFS, '" + data + "'";
+			return lib::IO::Graph::Read::dfs(data, err);
+		case Format::SMILES:
+			source = "smiles string, '" + data + "'";
+			return lib::IO::Graph::Read::smiles(data, err);
+		}
+		MOD_ABORT;
+	}
+
+	std::shared_ptr<Graph> load() const {
+		switch(format) {
+		case Format::GMLString: return Graph::graphGMLString(data);
+		case Format::GMLFile: return Graph::graphGML(data);
+		case Format::DFS: return Graph::graphDFS(data);
+		case Format::SMILES: return Graph::smiles(data);
+		}
+		MOD_ABORT;
+	}
+public:
+	const Format format;
+	const std::string data;
+	lib::Graph::LabelSummary summary;
+	boost::optional<std::string> name;
+	mutable std::mutex mtx;
+	std::shared_ptr<Graph> graph;
+	// the graph may outlive the strong reference, e.g., when stored in a derivation graph
+	std::weak_ptr<Graph> weakGraph;
+};
+
+LazyGraph::LazyGraph(std::unique_ptr<Pimpl> p) : p(std::move(p)) {}
+
+LazyGraph::~LazyGraph() = default;
+
+std::shared_ptr<Graph> LazyGraph::getGraph() {
+	std::lock_guard<std::mutex> lock(p->mtx);
+	if(p->graph) return p->graph;
+	p->graph = p->weakGraph.lock();
+	if(p->graph) return p->graph;
+	p->graph = p->load();
+	if(p->name) p->graph->setName(*p->name);
+	p->weakGraph = p->graph;
+	return p->graph;
+}
+
+bool LazyGraph::isMaterialised() const {
+	std::lock_guard<std::mutex> lock(p->mtx);
+	return p->graph || !p->weakGraph.expired();
+}
+
+void LazyGraph::release() {
+	std::lock_guard<std::mutex> lock(p->mtx);
+	p->graph.reset();
+}
+
+std::string LazyGraph::getName() const {
+	std::lock_guard<std::mutex> lock(p->mtx);
+	if(const auto g = p->weakGraph.lock()) return g->getName();
+	if(p->name) return *p->name;
+	return "";
+}
+
+void LazyGraph::setName(std::string name) {
+	std::lock_guard<std::mutex> lock(p->mtx);
+	if(const auto g = p->weakGraph.lock()) g->setName(name);
+	p->name = std::move(name);
+}
+
+std::size_t LazyGraph::numVertices() const {
+	return p->summary.numVertices;
+}
+
+std::size_t LazyGraph::numEdges() const {
+	return p->summary.numEdges;
+}
+
+unsigned int LazyGraph::vLabelCount(const std::string &label) const {
+	return p->summary.vertexLabelCount(label);
+}
+
+unsigned int LazyGraph::eLabelCount(const std::string &label) const {
+	return p->summary.edgeLabelCount(label);
+}
+
+bool LazyGraph::mayMatch(std::shared_ptr<rule::Rule> r, LabelType labelType) const {
+	if(labelType != LabelType::String) return true;
+	return mayMatch(lib::Graph::getLeftComponentSummaries(r->getRule()));
+}
+
+bool LazyGraph::mayMatch(const std::vector<lib::Graph::LabelSummary> &patterns) const {
+	for(const auto &pattern : patterns)
+		if(p->summary.mayContain(pattern)) return true;
+	return false;
+}
+
+std::shared_ptr<LazyGraph> LazyGraph::makeLazy(std::unique_ptr<Pimpl> p) {
+	p->summary = p->summarise();
+	return std::shared_ptr<LazyGraph>(new LazyGraph(std::move(p)));
+}
+
+std::shared_ptr<LazyGraph> LazyGraph::graphGMLString(const std::string &data) {
+	return makeLazy(std::make_unique<Pimpl>(Pimpl::Format::GMLString, data));
+}
+
+std::shared_ptr<LazyGraph> LazyGraph::graphGML(const std::string &file) {
+	return makeLazy(std::make_unique<Pimpl>(Pimpl::Format::GMLFile, file));
+}
+
+std::shared_ptr<LazyGraph> LazyGraph::graphDFS(const std::string &graphDFS) {
+	return makeLazy(std::make_unique<Pimpl>(Pimpl::Format::DFS, graphDFS));
+}
+
+std::shared_ptr<LazyGraph> LazyGraph::smiles(const std::string &smiles) {
+	return makeLazy(std::make_unique<Pimpl>(Pimpl::Format::SMILES, smiles));
+}
+
+} // namespace graph
+} // namespace mod
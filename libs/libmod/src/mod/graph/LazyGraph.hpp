@@ -0,0 +1,107 @@
+#ifndef MOD_GRAPH_LAZYGRAPH_H
+#define MOD_GRAPH_LAZYGRAPH_H
+
+#include <mod/BuildConfig.hpp>
+#include <mod/Config.hpp>
+#include <mod/graph/ForwardDecl.hpp>
+#include <mod/rule/ForwardDecl.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mod {
+namespace graph {
+
+// rst-class: graph::LazyGraph
+// rst:
+// rst:		A handle for a graph which is only loaded when needed.
+// rst:		The handle stores the source data of the graph (e.g., a SMILES string or a GML file name)
+// rst:		and a small summary of it: the number of vertices and edges, and the number of occurrences of each vertex and edge label.
+// rst:		The summary is computed when the handle is created, after which the loaded graph is discarded again.
+// rst:		The full graph, a :class:`Graph`, is loaded on the first call to :func:`getGraph`,
+// rst:		and the handle keeps it alive until :func:`release` is called.
+// rst:		As long as the graph is alive, e.g., because it has been added to a derivation graph,
+// rst:		:func:`getGraph` returns the same object.
+// rst:		Use :cpp:func:`dg::Strategy::makeAdd` to add lazy graphs to a derivation graph.
+// rst:
+// rst-class-start:
+
+struct MOD_DECL LazyGraph {
+	LazyGraph(const LazyGraph&) = delete;
+	LazyGraph &operator=(const LazyGraph&) = delete;
+	~LazyGraph();
+	// rst: .. function:: std::shared_ptr<Graph> getGraph()
+	// rst:
+	// rst:		:returns: the full graph, loaded from the source data if needed.
+	// rst:		:throws: :class:`InputError` if the source data can no longer be loaded, e.g., if the file has been deleted.
+	std::shared_ptr<Graph> getGraph();
+	// rst: .. function:: bool isMaterialised() const
+	// rst:
+	// rst:		:returns: whether the full graph is currently loaded.
+	bool isMaterialised() const;
+	// rst: .. function:: void release()
+	// rst:
+	// rst:		Drop the reference to the full graph held by this handle.
+	// rst:		The graph is only destroyed if no one else has a reference to it.
+	void release();
+	// rst: .. function:: std::string getName() const
+	// rst:               void setName(std::string name)
+	// rst:
+	// rst:		Access the name of the graph. If the name is not set, the name from the source data is used,
+	// rst:		which is only known after the graph has been loaded.
+	// rst:		A name set on the handle is applied to the graph when it is loaded.
+	std::string getName() const;
+	void setName(std::string name);
+	// rst: .. function:: std::size_t numVertices() const
+	// rst:               std::size_t numEdges() const
+	// rst:
+	// rst:		:returns: the number of vertices or edges in the graph, without loading it.
+	std::size_t numVertices() const;
+	std::size_t numEdges() const;
+	// rst: .. function:: unsigned int vLabelCount(const std::string &label) const
+	// rst:               unsigned int eLabelCount(const std::string &label) const
+	// rst:
+	// rst:		:returns: the number of vertices or edges with the given label, without loading the graph.
+	unsigned int vLabelCount(const std::string &label) const;
+	unsigned int eLabelCount(const std::string &label) const;
+	// rst: .. function:: bool mayMatch(std::shared_ptr<rule::Rule> r, LabelType labelType) const
+	// rst:
+	// rst:		A quick test, without loading the graph, of whether the left side of the given rule can be matched, at least partially, in the graph.
+	// rst:		That is, whether some connected component of the left side may have a monomorphism into the graph.
+	// rst:		For :enumerator:`LabelType::String` the test uses the graph size and the label counts.
+	// rst:		For :enumerator:`LabelType::Term` it is always `true`.
+	// rst:
+	// rst:		:returns: `false` only if no match can exist.
+	bool mayMatch(std::shared_ptr<rule::Rule> r, LabelType labelType) const;
+	// For LabelType::String, as above, but with the summaries of the connected components of the left sides
+	// computed in advance, e.g., for testing many graphs against the same rules.
+	// Returns true if some pattern may have a monomorphism into the graph.
+	bool mayMatch(const std::vector<lib::Graph::LabelSummary> &patterns) const;
+public:
+	// rst: .. function:: static std::shared_ptr<LazyGraph> graphGMLString(const std::string &data)
+	// rst:               static std::shared_ptr<LazyGraph> graphGML(const std::string &file)
+	// rst:               static std::shared_ptr<LazyGraph> graphDFS(const std::string &graphDFS)
+	// rst:               static std::shared_ptr<LazyGraph> smiles(const std::string &smiles)
+	// rst:
+	// rst:		Create a handle for a graph in the given format, see the corresponding functions in :class:`Graph`.
+	// rst:		The data is parsed once to validate it and to compute the summary.
+	// rst:
+	// rst:		:throws: :class:`InputError` on bad input.
+	static std::shared_ptr<LazyGraph> graphGMLString(const std::string &data);
+	static std::shared_ptr<LazyGraph> graphGML(const std::string &file);
+	static std::shared_ptr<LazyGraph> graphDFS(const std::string &graphDFS);
+	static std::shared_ptr<LazyGraph> smiles(const std::string &smiles);
+private:
+	struct Pimpl;
+	LazyGraph(std::unique_ptr<Pimpl> p);
+	static std::shared_ptr<LazyGraph> makeLazy(std::unique_ptr<Pimpl> p);
+private:
+	std::unique_ptr<Pimpl> p;
+};
+// rst-class-end:
+
+} // namespace graph
+} // namespace mod
+
+#endif /* MOD_GRAPH_LAZYGRAPH_H */
@@ -0,0 +1,81 @@
+#include "Arena.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace mod {
+namespace lib {
+namespace {
+thread_local Arena *currentArena = nullptr;
+} // namespace
+
+constexpr std::size_t Arena::InitialBlockSize;
+constexpr std::size_t Arena::MaxBlockSize;
+
+Arena::Arena() = default;
+
+Arena::~Arena() = default;
+
+void *Arena::allocate(std::size_t bytes, std::size_t alignment) {
+	assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+	++numAllocations;
+	if(cur) {
+		const auto addr = reinterpret_cast<std::uintptr_t>(cur);
+		char *p = cur + ((alignment - addr % alignment) % alignment);
+		if(p <= end && std::size_t(end - p) >= bytes) {
+			cur = p + bytes;
+			return p;
+		}
+	}
+	return allocateBlock(bytes, alignment);
+}
+
+void Arena::release() {
+	if(blocks.empty()) return;
+	auto largest = std::max_element(blocks.begin(), blocks.end(), [](const Block &a, const Block &b) {
+		return a.size < b.size;
+	});
+	Block kept = std::move(*largest);
+	blocks.clear();
+	blocks.push_back(std::move(kept));
+	cur = blocks.back().data.get();
+	end = cur + blocks.back().size;
+}
+
+std::size_t Arena::getNumAllocations() const {
+	return numAllocations;
+}
+
+std::size_t Arena::getNumBlocks() const {
+	return numBlocks;
+}
+
+void *Arena::allocateBlock(std::size_t bytes, std::size_t alignment) {
+	// blocks grow geometrically, and oversized requests get a block of their own
+	const std::size_t prevSize = blocks.empty() ? InitialBlockSize / 2 : blocks.back().size;
+	const std::size_t size = std::max(std::min(2 * prevSize, MaxBlockSize), bytes + alignment);
+	blocks.push_back(Block{std::unique_ptr<char[]>(new char[size]), size});
+	++numBlocks;
+	cur = blocks.back().data.get();
+	end = cur + size;
+	const auto addr = reinterpret_cast<std::uintptr_t>(cur);
+	char *p = cur + ((alignment - addr % alignment) % alignment);
+	cur = p + bytes;
+	return p;
+}
+
+ArenaScope::ArenaScope(Arena *arena) : prev(currentArena) {
+	currentArena = arena;
+}
+
+ArenaScope::~ArenaScope() {
+	currentArena = prev;
+}
+
+Arena *getCurrentArena() {
+	return currentArena;
+}
+
+} // namespace lib
+} // namespace mod
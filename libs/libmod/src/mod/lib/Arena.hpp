@@ -0,0 +1,105 @@
+#ifndef MOD_LIB_ARENA_H
+#define MOD_LIB_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace mod {
+namespace lib {
+
+// A monotonic allocator: allocations are carved out of large blocks, deallocation is a no-op,
+// and all memory is reclaimed at once by release or destruction.
+// An arena must only be allocated from by one thread at a time.
+struct Arena {
+	Arena();
+	Arena(const Arena &) = delete;
+	Arena &operator=(const Arena &) = delete;
+	~Arena();
+	void *allocate(std::size_t bytes, std::size_t alignment);
+	// Invalidates all allocations. The largest block is kept for the following allocations.
+	void release();
+	// The number of calls to allocate since construction.
+	std::size_t getNumAllocations() const;
+	// The number of blocks allocated from the heap since construction.
+	std::size_t getNumBlocks() const;
+private:
+	void *allocateBlock(std::size_t bytes, std::size_t alignment);
+private:
+	static constexpr std::size_t InitialBlockSize = 16 * 1024;
+	static constexpr std::size_t MaxBlockSize = 1024 * 1024;
+private:
+	struct Block {
+		std::unique_ptr<char[]> data;
+		std::size_t size;
+	};
+	std::vector<Block> blocks;
+	char *cur = nullptr;
+	char *end = nullptr;
+	std::size_t numAllocations = 0;
+	std::size_t numBlocks = 0;
+};
+
+// Sets the arena which ArenaAllocators in the calling thread allocate from when they are created,
+// and restores the previous one on destruction. A null arena means the heap.
+struct ArenaScope {
+	explicit ArenaScope(Arena *arena);
+	ArenaScope(const ArenaScope &) = delete;
+	ArenaScope &operator=(const ArenaScope &) = delete;
+	~ArenaScope();
+private:
+	Arena *const prev;
+};
+
+// The arena of the innermost ArenaScope in the calling thread, or null.
+Arena *getCurrentArena();
+
+// An allocator for containers which should be allocated from the arena of the current ArenaScope,
+// or from the heap if there is no such scope.
+// Copies of containers allocate from the arena current at the time of the copy,
+// so objects made within a scope must not outlive its arena.
+template<typename T>
+struct ArenaAllocator {
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+public:
+	ArenaAllocator() : arena(getCurrentArena()) { }
+
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) { }
+
+	T *allocate(std::size_t n) {
+		if(arena) return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+		else return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T *p, std::size_t n) {
+		if(!arena) std::allocator<T>().deallocate(p, n);
+	}
+
+	ArenaAllocator select_on_container_copy_construction() const {
+		return ArenaAllocator();
+	}
+
+	template<typename U>
+	friend bool operator==(const ArenaAllocator &a, const ArenaAllocator<U> &b) {
+		return a.arena == b.arena;
+	}
+
+	template<typename U>
+	friend bool operator!=(const ArenaAllocator &a, const ArenaAllocator<U> &b) {
+		return a.arena != b.arena;
+	}
+private:
+	template<typename U>
+	friend struct ArenaAllocator;
+	Arena *arena;
+};
+
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_ARENA_H */
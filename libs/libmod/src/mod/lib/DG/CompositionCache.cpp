@@ -0,0 +1,33 @@
+#include "CompositionCache.hpp"
+
+#include <mod/lib/Graph/Single.hpp>
+#include <mod/lib/Rules/Real.hpp>
+
+namespace mod {
+namespace lib {
+namespace DG {
+
+CompositionCache::CompositionCache() = default;
+CompositionCache::~CompositionCache() = default;
+
+const CompositionCache::Results *CompositionCache::find(const Rules::Real &r, const Graph::Single &g) const {
+	std::lock_guard<std::mutex> lock(mtx);
+	const auto iter = entries.find({r.getId(), g.getId()});
+	if(iter == entries.end()) return nullptr;
+	return &iter->second;
+}
+
+const CompositionCache::Results &
+CompositionCache::insert(const Rules::Real &r, const Graph::Single &g, Results results) {
+	std::lock_guard<std::mutex> lock(mtx);
+	return entries.emplace(std::make_pair(r.getId(), g.getId()), std::move(results)).first->second;
+}
+
+std::size_t CompositionCache::size() const {
+	std::lock_guard<std::mutex> lock(mtx);
+	return entries.size();
+}
+
+} // namespace DG
+} // namespace lib
+} // namespace mod
@@ -0,0 +1,50 @@
+#ifndef MOD_LIB_DG_COMPOSITIONCACHE_H
+#define MOD_LIB_DG_COMPOSITIONCACHE_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace mod {
+namespace lib {
+namespace Rules {
+struct Real;
+} // namespace Rules
+namespace Graph {
+struct Single;
+} // namespace Graph
+namespace DG {
+
+// Memoises the results of binding a graph to a (partially bound) rule, i.e., of composing the bind rule
+// of the graph with the rule, such that repeated executions on the same derivation graph skip the matching.
+// The entries are keyed by the ids of the rule and the graph, and the resulting rules are owned by the cache.
+// Rule ids are only stable for rules given by the user and for the rules owned by the cache,
+// so only those should be used as keys.
+// All member functions may be called concurrently.
+struct CompositionCache {
+	using Results = std::vector<std::unique_ptr<const Rules::Real> >;
+public:
+	CompositionCache();
+	~CompositionCache();
+	// Returns nullptr if (r, g) has not been inserted.
+	const Results *find(const Rules::Real &r, const Graph::Single &g) const;
+	// If (r, g) has already been inserted, then the given results are discarded.
+	// The results must be prepared for concurrent reading, as other threads may read them after the insertion.
+	// Returns the results stored for (r, g).
+	const Results &insert(const Rules::Real &r, const Graph::Single &g, Results results);
+	// The number of (rule, graph) pairs.
+	std::size_t size() const;
+private:
+	mutable std::mutex mtx;
+	// std::map, so references to the results stay valid
+	std::map<std::pair<std::size_t, std::size_t>, Results> entries;
+};
+
+} // namespace DG
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_DG_COMPOSITIONCACHE_H */
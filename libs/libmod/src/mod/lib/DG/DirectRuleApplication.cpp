@@ -0,0 +1,258 @@
+#include "DirectRuleApplication.hpp"
+
+#include <mod/rule/Rule.hpp>
+#include <mod/lib/RC/MatchMaker/ComponentWiseUtil.hpp>
+
+#include <limits>
+#include <numeric>
+#include <set>
+#include <tuple>
+
+namespace mod {
+namespace lib {
+namespace DG {
+namespace {
+constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+} // namespace
+
+DirectRuleApplication::DirectRuleApplication(const lib::Rules::Real &r, LabelSettings labelSettings,
+                                             bool verbose, IO::Logger logger)
+		: r(r), labelSettings(labelSettings), verbose(verbose), logger(logger) {
+	assert(isSupported(labelSettings));
+	const auto &rDPO = r.getDPORule();
+	const auto &lgLeft = get_labelled_left(rDPO);
+	const auto &gCore = get_graph(rDPO);
+	compVertices.resize(rDPO.numLeftComponents);
+	for(std::size_t comp = 0; comp != compVertices.size(); ++comp) {
+		for(const auto v : asRange(vertices(get_component_graph(comp, lgLeft))))
+			compVertices[comp].push_back(get(boost::vertex_index_t(), gCore, v));
+	}
+}
+
+bool DirectRuleApplication::isSupported(LabelSettings labelSettings) {
+	// terms would need unification across the components, and stereo information would need the composition of the embeddings
+	return labelSettings.type == LabelType::String && !labelSettings.withStereo;
+}
+
+void DirectRuleApplication::apply(const GraphList &universe,
+                                  const std::unordered_set<const lib::Graph::Single *> *subset,
+                                  const std::unordered_set<const lib::Graph::Single *> *tried,
+                                  OnDerivation onDerivation) {
+	this->universe = &universe;
+	this->subset = subset;
+	this->tried = tried;
+	this->onDerivation = std::move(onDerivation);
+	matches.assign(compVertices.size(), std::vector<boost::optional<Matches> >(universe.size()));
+	instances.clear();
+	match.assign(num_vertices(get_graph(r.getDPORule())), {npos, npos});
+	enumerate(0, false);
+	this->onDerivation = nullptr;
+	this->universe = nullptr;
+}
+
+std::size_t DirectRuleApplication::getNumComponentMatchings() const {
+	return numComponentMatchings;
+}
+
+std::size_t DirectRuleApplication::getNumMatches() const {
+	return numMatches;
+}
+
+const DirectRuleApplication::Matches &DirectRuleApplication::getMatches(std::size_t comp, std::size_t graph) {
+	auto &result = matches[comp][graph];
+	if(result) return *result;
+	++numComponentMatchings;
+	result = Matches();
+	const auto &lgLeft = get_labelled_left(r.getDPORule());
+	// the bind rule has the graph as right side, with the same vertex indices
+	const auto &rHost = (*universe)[graph]->getBindRule()->getRule().getDPORule();
+	const auto &lgHost = get_labelled_right(rHost);
+	assert(rHost.numRightComponents == 1);
+	const auto mp = RC::makeRuleRuleComponentMonomorphism(lgLeft, lgHost, true, labelSettings, verbose, logger);
+	for(const auto &morphism : mp(comp, 0)) {
+		std::vector<std::size_t> hostVertices;
+		hostVertices.reserve(compVertices[comp].size());
+		for(const std::size_t vId : compVertices[comp]) {
+			const auto vHost = get(morphism, get_graph(lgLeft), get_graph(lgHost), vertex(vId, get_graph(r.getDPORule())));
+			hostVertices.push_back(get(boost::vertex_index_t(), get_graph(rHost), vHost));
+		}
+		result->push_back(std::move(hostVertices));
+	}
+	return *result;
+}
+
+bool DirectRuleApplication::enumerate(std::size_t comp, bool hasSubset) {
+	if(comp == compVertices.size()) {
+		if(subset && !hasSubset) return true;
+		if(tried) {
+			const bool allTried = std::all_of(instances.begin(), instances.end(), [this](const Instance &inst) {
+				return tried->find((*universe)[inst.graph]) != tried->end();
+			});
+			if(allTried) return true;
+		}
+		++numMatches;
+		auto products = rewrite();
+		if(!products) {
+			if(verbose) logger.indent() << "Match rejected by the rewrite" << std::endl;
+			return true;
+		}
+		GraphList educts;
+		educts.reserve(instances.size());
+		for(const Instance &inst : instances)
+			educts.push_back((*universe)[inst.graph]);
+		return onDerivation(educts, std::move(*products));
+	}
+	// with only one component left, a graph from the subset must be introduced now, if none has been
+	const bool needSubset = subset && !hasSubset && comp + 1 == compVertices.size();
+	// either the component is matched into an already matched graph
+	if(!needSubset) {
+		for(std::size_t inst = 0; inst != instances.size(); ++inst)
+			if(!tryInstance(comp, inst, hasSubset)) return false;
+	}
+	// or into a new copy of a graph
+	for(std::size_t graph = 0; graph != universe->size(); ++graph) {
+		const lib::Graph::Single *g = (*universe)[graph];
+		const bool inSubset = subset && subset->find(g) != subset->end();
+		if(needSubset && !inSubset) continue;
+		instances.push_back(Instance{graph, std::vector<bool>(num_vertices(g->getGraph()), false)});
+		const bool cont = tryInstance(comp, instances.size() - 1, hasSubset || inSubset);
+		instances.pop_back();
+		if(!cont) return false;
+	}
+	return true;
+}
+
+bool DirectRuleApplication::tryInstance(std::size_t comp, std::size_t inst, bool hasSubset) {
+	// note: instances may grow during the recursion, so no references into it are kept
+	const Matches &ms = getMatches(comp, instances[inst].graph);
+	const auto &vs = compVertices[comp];
+	for(const std::vector<std::size_t> &m : ms) {
+		const bool injective = std::none_of(m.begin(), m.end(), [this, inst](std::size_t vHost) {
+			return instances[inst].used[vHost];
+		});
+		if(!injective) continue;
+		for(std::size_t i = 0; i != m.size(); ++i) {
+			instances[inst].used[m[i]] = true;
+			match[vs[i]] = {inst, m[i]};
+		}
+		const bool cont = enumerate(comp + 1, hasSubset);
+		for(const std::size_t vHost : m)
+			instances[inst].used[vHost] = false;
+		if(!cont) return false;
+	}
+	return true;
+}
+
+boost::optional<std::vector<GraphData> > DirectRuleApplication::rewrite() const {
+	using Membership = jla_boost::GraphDPO::Membership;
+	const auto &rDPO = r.getDPORule();
+	const auto &gCore = get_graph(rDPO);
+	const auto &pCore = get_string(rDPO);
+	// the result as a single, possibly disconnected, graph
+	std::vector<const std::string *> vLabels;
+	std::vector<std::tuple<std::size_t, std::size_t, const std::string *> > eResult;
+	std::set<std::pair<std::size_t, std::size_t> > adjacent;
+	const auto addEdge = [&](std::size_t vSrc, std::size_t vTar, const std::string &label) {
+		if(!adjacent.emplace(std::min(vSrc, vTar), std::max(vSrc, vTar)).second) return false;
+		eResult.emplace_back(vSrc, vTar, &label);
+		return true;
+	};
+	std::vector<std::size_t> ruleToResult(num_vertices(gCore), npos);
+	for(std::size_t inst = 0; inst != instances.size(); ++inst) {
+		const lib::Graph::Single &g = *(*universe)[instances[inst].graph];
+		const auto &gHost = g.getGraph();
+		const auto &pHost = g.getStringState();
+		std::vector<std::size_t> preimage(num_vertices(gHost), npos);
+		for(const auto vCore : asRange(vertices(gCore))) {
+			if(membership(rDPO, vCore) == Membership::Right) continue;
+			const auto vId = get(boost::vertex_index_t(), gCore, vCore);
+			if(match[vId].first == inst) preimage[match[vId].second] = vId;
+		}
+		// copy the host, except for the deleted vertices, and relabel the matched vertices
+		std::vector<std::size_t> hostToResult(num_vertices(gHost), npos);
+		for(const auto vHost : asRange(vertices(gHost))) {
+			const auto vHostId = get(boost::vertex_index_t(), gHost, vHost);
+			const auto vCoreId = preimage[vHostId];
+			if(vCoreId == npos) {
+				hostToResult[vHostId] = vLabels.size();
+				vLabels.push_back(&pHost[vHost]);
+				continue;
+			}
+			const auto vCore = vertex(vCoreId, gCore);
+			if(membership(rDPO, vCore) == Membership::Left) continue;
+			hostToResult[vHostId] = ruleToResult[vCoreId] = vLabels.size();
+			vLabels.push_back(&*pCore[vCore].second);
+		}
+		for(const auto eHost : asRange(edges(gHost))) {
+			const auto vSrcHostId = get(boost::vertex_index_t(), gHost, source(eHost, gHost));
+			const auto vTarHostId = get(boost::vertex_index_t(), gHost, target(eHost, gHost));
+			const auto vSrcCoreId = preimage[vSrcHostId];
+			const auto vTarCoreId = preimage[vTarHostId];
+			const std::string *label = &pHost[eHost];
+			if(vSrcCoreId != npos && vTarCoreId != npos) {
+				const auto epCore = edge(vertex(vSrcCoreId, gCore), vertex(vTarCoreId, gCore), gCore);
+				if(epCore.second && membership(rDPO, epCore.first) != Membership::Right) {
+					// the host edge is the image of a left edge
+					if(membership(rDPO, epCore.first) == Membership::Left) continue;
+					label = &*pCore[epCore.first].second;
+				}
+			}
+			const auto vSrc = hostToResult[vSrcHostId];
+			const auto vTar = hostToResult[vTarHostId];
+			// an edge which is not deleted, but is incident to a deleted vertex
+			if(vSrc == npos || vTar == npos) return boost::none;
+			const bool added = addEdge(vSrc, vTar, *label);
+			assert(added);
+			(void) added;
+		}
+	}
+	// add the created vertices and edges
+	for(const auto vCore : asRange(vertices(gCore))) {
+		if(membership(rDPO, vCore) != Membership::Right) continue;
+		ruleToResult[get(boost::vertex_index_t(), gCore, vCore)] = vLabels.size();
+		vLabels.push_back(&*pCore[vCore].second);
+	}
+	for(const auto eCore : asRange(edges(gCore))) {
+		if(membership(rDPO, eCore) != Membership::Right) continue;
+		const auto vSrc = ruleToResult[get(boost::vertex_index_t(), gCore, source(eCore, gCore))];
+		const auto vTar = ruleToResult[get(boost::vertex_index_t(), gCore, target(eCore, gCore))];
+		assert(vSrc != npos);
+		assert(vTar != npos);
+		// an edge parallel to an existing edge
+		if(!addEdge(vSrc, vTar, *pCore[eCore].second)) return boost::none;
+	}
+
+	// split into connected components
+	std::vector<std::size_t> parent(vLabels.size());
+	std::iota(parent.begin(), parent.end(), 0);
+	const auto find = [&parent](std::size_t v) {
+		while(parent[v] != v) v = parent[v] = parent[parent[v]];
+		return v;
+	};
+	for(const auto &e : eResult)
+		parent[find(std::get<0>(e))] = find(std::get<1>(e));
+	std::vector<GraphData> products;
+	std::vector<std::size_t> rootToProduct(vLabels.size(), npos);
+	std::vector<lib::Graph::Vertex> resultToProduct(vLabels.size());
+	for(std::size_t v = 0; v != vLabels.size(); ++v) {
+		auto &pId = rootToProduct[find(v)];
+		if(pId == npos) {
+			pId = products.size();
+			products.emplace_back();
+		}
+		auto &p = products[pId];
+		resultToProduct[v] = add_vertex(*p.gPtr);
+		p.pStringPtr->addVertex(resultToProduct[v], *vLabels[v]);
+	}
+	for(const auto &e : eResult) {
+		auto &p = products[rootToProduct[find(std::get<0>(e))]];
+		const auto ep = add_edge(resultToProduct[std::get<0>(e)], resultToProduct[std::get<1>(e)], *p.gPtr);
+		assert(ep.second);
+		p.pStringPtr->addEdge(ep.first, *std::get<2>(e));
+	}
+	return products;
+}
+
+} // namespace DG
+} // namespace lib
+} // namespace mod
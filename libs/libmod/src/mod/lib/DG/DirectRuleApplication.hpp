@@ -0,0 +1,76 @@
+#ifndef MOD_LIB_DG_DIRECTRULEAPPLICATION_H
+#define MOD_LIB_DG_DIRECTRULEAPPLICATION_H
+
+#include <mod/lib/DG/RuleApplicationUtils.hpp>
+#include <mod/lib/IO/IO.hpp>
+
+#include <boost/optional.hpp>
+
+#include <functional>
+#include <unordered_set>
+#include <vector>
+
+namespace mod {
+namespace lib {
+namespace DG {
+
+// Applies a rule by matching its left side directly into multisets of graphs and rewriting a copy of the matched graphs,
+// instead of composing the rule with the bind rules of the graphs one component at a time.
+// The left components are matched with the same component monomorphisms as in the composition,
+// and the rewrite is rejected in the same cases as a composition would be,
+// i.e., for dangling edges and for edges created in parallel with existing edges.
+// Only string labels without stereo information are supported, see isSupported.
+struct DirectRuleApplication {
+	using GraphList = std::vector<const lib::Graph::Single *>;
+	// Called with the educts and the (not yet wrapped) connected components of the result of each match.
+	// Return false to stop the enumeration.
+	using OnDerivation = std::function<bool(const GraphList &educts, std::vector<GraphData> products)>;
+public:
+	DirectRuleApplication(const lib::Rules::Real &r, LabelSettings labelSettings, bool verbose, IO::Logger logger);
+	static bool isSupported(LabelSettings labelSettings);
+	// Enumerates all matches of the left side into the universe graphs,
+	// where at least one of the matched graphs is in the subset, unless subset is null.
+	// Matches using only graphs from tried are skipped, unless tried is null.
+	void apply(const GraphList &universe,
+	           const std::unordered_set<const lib::Graph::Single *> *subset,
+	           const std::unordered_set<const lib::Graph::Single *> *tried,
+	           OnDerivation onDerivation);
+	// The number of component-graph pairs for which morphisms were computed.
+	std::size_t getNumComponentMatchings() const;
+	// The number of complete matches found, i.e., including those rejected by the rewrite.
+	std::size_t getNumMatches() const;
+private:
+	struct Instance {
+		std::size_t graph; // index into the universe
+		std::vector<bool> used;
+	};
+	// for each left component morphism, the host vertex index of each vertex in compVertices
+	using Matches = std::vector<std::vector<std::size_t> >;
+private:
+	const Matches &getMatches(std::size_t comp, std::size_t graph);
+	bool enumerate(std::size_t comp, bool hasSubset);
+	bool tryInstance(std::size_t comp, std::size_t instance, bool hasSubset);
+	boost::optional<std::vector<GraphData> > rewrite() const;
+private:
+	const lib::Rules::Real &r;
+	const LabelSettings labelSettings;
+	const bool verbose;
+	IO::Logger logger;
+	// the core vertex indices of each left component
+	std::vector<std::vector<std::size_t> > compVertices;
+	std::vector<std::vector<boost::optional<Matches> > > matches;
+	std::size_t numComponentMatchings = 0, numMatches = 0;
+private: // the state of the current enumeration
+	const GraphList *universe;
+	const std::unordered_set<const lib::Graph::Single *> *subset, *tried;
+	OnDerivation onDerivation;
+	std::vector<Instance> instances;
+	// for each core vertex of the rule in the left side: the instance and host vertex index it is matched to
+	std::vector<std::pair<std::size_t, std::size_t> > match;
+};
+
+} // namespace DG
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_DG_DIRECTRULEAPPLICATION_H */
@@ -15,6 +15,7 @@
 #include <jla_boost/graph/PairToRangeAdaptor.hpp>
 
 #include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/optional.hpp>
 #include <boost/spirit/home/x3/char/char.hpp>
 #include <boost/spirit/home/x3/char/char_class.hpp>
 #include <boost/spirit/home/x3/directive/lexeme.hpp>
@@ -24,67 +25,177 @@
 #include <boost/spirit/home/x3/operator/difference.hpp>
 #include <boost/spirit/home/x3/operator/kleene.hpp>
 
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
 namespace mod {
 namespace lib {
 namespace DG {
 namespace Dump {
 namespace {
 
-struct ConstructionData {
-	const std::vector<std::shared_ptr<rule::Rule> > &rules;
-	std::vector<std::tuple<
-			unsigned int,
-			std::string,
-			std::unique_ptr<lib::Graph::GraphType>,
-			std::unique_ptr<lib::Graph::PropString>
-	>> vertices;
-	const std::vector<std::tuple<unsigned int, std::string> > rulesParsed;
-	const std::vector<std::tuple<unsigned int, std::vector<unsigned int>, std::vector<int> > > edges;
+// The binary format stores integers in the native byte order,
+// so the header contains a probe value to reject files from machines with a different byte order.
+// Each vertex graph is stored with its key in the graph database (see Graph::Collection::getStats),
+// which is reused on load when the key signature matches the one of the loading DG.
+//
+// magic, version, byte order probe, key signature, numVertices, numRules, numEdges
+// vertex: id, name, numVertices, vertex labels, numEdges, (source, target, label) edges, key
+// rule: id, name
+// edge: id, numRules, rule ids, numAdj, adjacency (negative for sources, positive for targets, both 1-indexed)
+constexpr char binaryMagic[8] = {'M', 'O', 'D', 'D', 'G', 'B', 'I', 'N'};
+constexpr std::uint64_t binaryVersion = 1;
+constexpr std::uint64_t byteOrderProbe = 0x0102030405060708;
+
+struct BinaryWriter {
+	explicit BinaryWriter(std::ostream &s) : s(s) {}
+
+	void writeUInt(std::uint64_t v) {
+		s.write(reinterpret_cast<const char *>(&v), sizeof(v));
+	}
+
+	void writeInt(std::int64_t v) {
+		s.write(reinterpret_cast<const char *>(&v), sizeof(v));
+	}
+
+	void writeString(const std::string &str) {
+		writeUInt(str.size());
+		s.write(str.data(), str.size());
+	}
+private:
+	std::ostream &s;
 };
 
-struct NonHyperDump : public NonHyper {
-	NonHyperDump(const std::vector<std::shared_ptr<graph::Graph> > &graphs,
-	             ConstructionData &&constructionData)
-			: NonHyper({LabelType::String, LabelRelation::Isomorphism}, graphs, IsomorphismPolicy::Check) {
-		calculatePrologue();
-		constexpr bool printInfo = true;
-		const std::vector<std::shared_ptr<rule::Rule> > &rules = constructionData.rules;
-		auto &vertices = constructionData.vertices;
-		const auto &rulesParsed = constructionData.rulesParsed;
-		const auto &edges = constructionData.edges;
+struct BinaryReader {
+	BinaryReader(const char *first, const char *last) : first(first), last(last) {}
+
+	bool readUInt(std::uint64_t &v) {
+		if(static_cast<std::size_t>(last - first) < sizeof(v)) return false;
+		std::memcpy(&v, first, sizeof(v));
+		first += sizeof(v);
+		return true;
+	}
+
+	bool readInt(std::int64_t &v) {
+		if(static_cast<std::size_t>(last - first) < sizeof(v)) return false;
+		std::memcpy(&v, first, sizeof(v));
+		first += sizeof(v);
+		return true;
+	}
+
+	bool readString(std::string &str) {
+		std::uint64_t size;
+		if(!readUInt(size)) return false;
+		if(static_cast<std::size_t>(last - first) < size) return false;
+		str.assign(first, first + size);
+		first += size;
+		return true;
+	}
+
+	// Whether the remaining data can hold count records of at least minSize bytes each.
+	bool canHold(std::uint64_t count, std::size_t minSize) const {
+		return count <= static_cast<std::size_t>(last - first) / minSize;
+	}
+private:
+	const char *first;
+	const char *last;
+};
+
+template<typename Iter>
+auto makePosIter(Iter iter) {
+	return IO::PositionIter<Iter>(iter);
+}
+
+template<typename Iter, typename Parser, typename Attr>
+bool parse(Iter &textFirst,
+           IO::PositionIter<Iter> &first,
+           const IO::PositionIter<Iter> &last,
+           const Parser &p,
+           Attr &attr,
+           std::ostream &err) {
+	try {
+		bool res = IO::detail::ParseDispatch<x3::space_type>::parse(first, last, p, attr, x3::space);
+		if(!res) {
+			err << "Error while parsing DG dump.\n";
+			IO::detail::doParserError(textFirst, first, last, lib::IO::log());
+			return false;
+		}
+		return res;
+	} catch(const x3::expectation_failure<IO::PositionIter<Iter>> &e) {
+		err << "Error while parsing DG dump.\n";
+		IO::detail::doParserExpectationError(e, textFirst, last, err);
+		return false;
+	}
+}
+
+} // namespace
+
+// The parsed content of a dump, in either format.
+struct Loader {
+	struct VertexData {
+		unsigned int id;
+		std::string name;
+		std::unique_ptr<lib::Graph::GraphType> g;
+		std::unique_ptr<lib::Graph::PropString> pString;
+		Graph::CollectionStats stats; // only valid if keySignature is set
+	};
+public:
+	bool parse(const std::string &file, std::ostream &err) {
+		boost::iostreams::mapped_file_source ifs(file);
+		const char *first = ifs.data();
+		const char *last = first + ifs.size();
+		const bool isBinary = ifs.size() >= sizeof(binaryMagic)
+		                      && std::equal(binaryMagic, binaryMagic + sizeof(binaryMagic), first);
+		const bool res = isBinary
+		                 ? parseBinary(first + sizeof(binaryMagic), last, err)
+		                 : parseText(first, last, err);
+		return res && checkIds(err);
+	}
+
+	// Returns the linked rules.
+	std::vector<std::shared_ptr<rule::Rule>> apply(NonHyper &dg,
+	                                               const std::vector<std::shared_ptr<rule::Rule>> &rules,
+	                                               bool printInfo) {
+		// the first rule with a given name is used
+		std::unordered_map<std::string, std::shared_ptr<rule::Rule>> ruleFromName;
+		ruleFromName.reserve(rules.size());
+		for(const auto &r : rules)
+			ruleFromName.emplace(r->getName(), r);
+		std::vector<std::shared_ptr<rule::Rule>> linkedRules;
 		std::unordered_map<unsigned int, std::shared_ptr<rule::Rule> > ruleMap;
 		std::unordered_map<unsigned int, std::shared_ptr<graph::Graph> > graphMap;
-		this->rules.reserve(rulesParsed.size());
+		linkedRules.reserve(rulesParsed.size());
 		ruleMap.reserve(rulesParsed.size());
 		graphMap.reserve(vertices.size());
 		for(const auto &t : rulesParsed) {
-			const auto iter = std::find_if(begin(rules), end(rules), [&t](std::shared_ptr<rule::Rule> r) -> bool {
-				return r->getName() == get<1>(t);
-			});
-			if(iter == end(rules)) {
+			const auto iter = ruleFromName.find(get<1>(t));
+			if(iter == end(ruleFromName)) {
 				std::string msg = "Can not load DG dump. Rule not found: '" + get<1>(t) + "'";
 				throw InputError(std::move(msg));
 			}
-			std::shared_ptr<rule::Rule> r = *iter;
+			std::shared_ptr<rule::Rule> r = iter->second;
 			if(printInfo)
 				IO::log() << "Rule linked: " << r->getName() << std::endl;
-			this->rules.push_back(r);
+			linkedRules.push_back(r);
 			ruleMap[get<0>(t)] = r;
 		}
 
+		// with matching keys we can skip the hashing of each graph
+		const bool useKeys = keySignature && *keySignature == dg.graphDatabase.getKeySignature();
 		// do merge of vertices and edges in order of increasing id
 		unsigned int iVertices = 0;
 		unsigned int iEdges = 0;
 		for(unsigned int id = 0; id < vertices.size() + edges.size(); id++) {
-			if(iVertices < vertices.size() && get<0>(vertices[iVertices]) == id) {
+			if(iVertices < vertices.size() && vertices[iVertices].id == id) {
 				auto &v = vertices[iVertices];
-				auto gCand = std::make_unique<lib::Graph::Single>(std::move(get<2>(v)), std::move(get<3>(v)), nullptr);
-				auto p = checkIfNew(std::move(gCand));
-				bool wasNew = trustAddGraphAsVertex(p.first);
+				auto gCand = std::make_unique<lib::Graph::Single>(std::move(v.g), std::move(v.pString), nullptr);
+				auto p = useKeys ? dg.checkIfNew(std::move(gCand), v.stats) : dg.checkIfNew(std::move(gCand));
+				bool wasNew = useKeys ? dg.trustAddGraphAsVertex(p.first, v.stats) : dg.trustAddGraphAsVertex(p.first);
 				graphMap[id] = p.first;
 				if(!p.second && printInfo)
-					IO::log() << "Graph linked: " << get<1>(v) << " -> " << p.first->getName() << std::endl;
-				if(wasNew) giveProductStatus(p.first);
+					IO::log() << "Graph linked: " << v.name << " -> " << p.first->getName() << std::endl;
+				if(wasNew) dg.giveProductStatus(p.first);
 				iVertices++;
 			} else if(iEdges < edges.size() && get<0>(edges[iEdges]) == id) {
 				const auto &e = edges[iEdges];
@@ -108,13 +219,13 @@ struct NonHyperDump : public NonHyper {
 				GraphMultiset gmsSrc(std::move(srcGraphs)), gmsTar(std::move(tarGraphs));
 				const auto &ruleIds = get<1>(e);
 				if(ruleIds.empty()) {
-					suggestDerivation(std::move(gmsSrc), std::move(gmsTar), nullptr);
+					dg.suggestDerivation(std::move(gmsSrc), std::move(gmsTar), nullptr);
 				} else {
 					for(const auto rId : ruleIds) {
 						auto rIter = ruleMap.find(rId);
 						assert(rIter != end(ruleMap));
 						const auto *r = &rIter->second->getRule();
-						suggestDerivation(std::move(gmsSrc), std::move(gmsTar), r);
+						dg.suggestDerivation(gmsSrc, gmsTar, r);
 					}
 				}
 				++iEdges;
@@ -122,6 +233,289 @@ struct NonHyperDump : public NonHyper {
 				MOD_ABORT;
 			}
 		}
+		return linkedRules;
+	}
+private:
+	bool parseText(const char *textFirst, const char *textLast, std::ostream &err) {
+		auto first = makePosIter(textFirst);
+		const auto last = makePosIter(textLast);
+
+		unsigned int numVertices, numEdges, numRules;
+#define PARSE(p, a) if(!Dump::parse(textFirst, first, last, p, a, err)) return false
+#define TRY_PARSE(p, a) Dump::parse(textFirst, first, last, p, a, err)
+		unsigned int version = 1;
+		TRY_PARSE("version:" >> x3::uint_, version);
+		PARSE("numVertices:" >> x3::uint_, numVertices);
+		PARSE("numEdges:" >> x3::uint_, numEdges);
+		PARSE("numRules:" >> x3::uint_, numRules);
+		vertices.reserve(numVertices);
+		for(unsigned int i = 0; i < numVertices; i++) {
+			unsigned int id;
+			std::string name, dfs;
+			PARSE("vertex:" >> x3::uint_, id);
+			PARSE('"' >> x3::lexeme[*(x3::char_ - '"') >> '"'], name);
+			PARSE('"' >> x3::lexeme[*(x3::char_ - '"') >> '"'], dfs);
+			auto gData = IO::Graph::Read::dfs(dfs, err);
+			if(!gData.g) {
+				err << "GraphDFS \"" << dfs << "\" could not be parsed for vertex " << id << std::endl;
+				return false;
+			}
+			if(gData.pStereo) MOD_ABORT;
+			vertices.push_back(VertexData{id, std::move(name), std::move(gData.g), std::move(gData.pString), {}});
+		}
+		rulesParsed.reserve(numRules);
+		for(unsigned int i = 0; i < numRules; i++) {
+			unsigned int id;
+			std::string name;
+			PARSE("rule:" >> x3::uint_, id);
+			PARSE('"' >> x3::lexeme[*(x3::char_ - '"') >> '"'], name);
+			rulesParsed.emplace_back(id, std::move(name));
+		}
+		edges.reserve(numEdges);
+		std::vector<int> adj;
+		adj.reserve(numVertices); // probably a huge overestimation
+		for(unsigned int i = 0; i < numEdges; i++) {
+			unsigned int id;
+			std::vector<unsigned int> ruleIds;
+			PARSE("edge:" >> x3::uint_, id);
+			unsigned int numRules;
+			if(version == 1) numRules = 1;
+			else PARSE(x3::uint_, numRules);
+			ruleIds.reserve(numRules);
+			for(std::size_t i = 0; i < numRules; ++i) {
+				unsigned int ruleId;
+				PARSE(x3::uint_, ruleId);
+				ruleIds.push_back(ruleId);
+			}
+			PARSE(*x3::int_, adj);
+			edges.emplace_back(id, std::move(ruleIds), adj);
+			adj.clear();
+		}
+#undef PARSE
+#undef TRY_PARSE
+		return true;
+	}
+
+	bool parseBinary(const char *first, const char *last, std::ostream &err) {
+		BinaryReader r(first, last);
+		const auto truncated = [&err]() {
+			err << "Parsed data is corrupt, the binary DG dump is truncated." << std::endl;
+			return false;
+		};
+		std::uint64_t version, probe, signature, numVertices, numRules, numEdges;
+		if(!r.readUInt(version)) return truncated();
+		if(version != binaryVersion) {
+			err << "Unsupported binary DG dump version, " << version << ", expected " << binaryVersion << "." << std::endl;
+			return false;
+		}
+		if(!r.readUInt(probe)) return truncated();
+		if(probe != byteOrderProbe) {
+			err << "The binary DG dump was written on a machine with a different byte order." << std::endl;
+			return false;
+		}
+		if(!r.readUInt(signature)) return truncated();
+		keySignature = signature;
+		if(!r.readUInt(numVertices)) return truncated();
+		if(!r.readUInt(numRules)) return truncated();
+		if(!r.readUInt(numEdges)) return truncated();
+		// the counts are checked against the remaining data before reserving,
+		// using the minimum size of each record, i.e., with empty strings and lists
+		const std::size_t intSize = sizeof(std::uint64_t);
+		const auto invalidId = [&err](const char *kind, std::uint64_t id) {
+			err << "Parsed data is corrupt, invalid " << kind << " id, " << id << "." << std::endl;
+			return false;
+		};
+		const std::uint64_t maxId = std::numeric_limits<unsigned int>::max();
+		// id, name, n, m, and the 3 key values
+		if(!r.canHold(numVertices, 7 * intSize)) return truncated();
+		vertices.reserve(numVertices);
+		for(std::uint64_t i = 0; i < numVertices; ++i) {
+			std::uint64_t id, n, m;
+			std::string name;
+			if(!r.readUInt(id)) return truncated();
+			if(id > maxId) return invalidId("vertex", id);
+			if(!r.readString(name)) return truncated();
+			auto g = std::make_unique<lib::Graph::GraphType>();
+			auto pString = std::make_unique<lib::Graph::PropString>(*g);
+			if(!r.readUInt(n)) return truncated();
+			std::string label;
+			std::vector<lib::Graph::Vertex> vs;
+			if(!r.canHold(n, intSize)) return truncated();
+			vs.reserve(n);
+			for(std::uint64_t vId = 0; vId < n; ++vId) {
+				if(!r.readString(label)) return truncated();
+				const auto v = add_vertex(*g);
+				pString->addVertex(v, label);
+				vs.push_back(v);
+			}
+			if(!r.readUInt(m)) return truncated();
+			for(std::uint64_t eId = 0; eId < m; ++eId) {
+				std::uint64_t src, tar;
+				if(!r.readUInt(src)) return truncated();
+				if(!r.readUInt(tar)) return truncated();
+				if(!r.readString(label)) return truncated();
+				if(src >= n || tar >= n || src == tar || edge(vs[src], vs[tar], *g).second) {
+					err << "Parsed data is corrupt, invalid edge (" << src << ", " << tar << ") in vertex " << id << "." << std::endl;
+					return false;
+				}
+				const auto e = add_edge(vs[src], vs[tar], *g);
+				pString->addEdge(e.first, label);
+			}
+			std::uint64_t keyN, keyM, keyInvariant;
+			if(!r.readUInt(keyN)) return truncated();
+			if(!r.readUInt(keyM)) return truncated();
+			if(!r.readUInt(keyInvariant)) return truncated();
+			// the keys are trusted when the signature matches, so at least check the parts we can check cheaply
+			if(keyN != n || keyM != m) {
+				err << "Parsed data is corrupt, the graph database key of vertex " << id << " does not match its graph." << std::endl;
+				return false;
+			}
+			Graph::CollectionStats stats{keyN, keyM, keyInvariant};
+			vertices.push_back(VertexData{static_cast<unsigned int>(id), std::move(name), std::move(g), std::move(pString), stats});
+		}
+		// id and name
+		if(!r.canHold(numRules, 2 * intSize)) return truncated();
+		rulesParsed.reserve(numRules);
+		for(std::uint64_t i = 0; i < numRules; ++i) {
+			std::uint64_t id;
+			std::string name;
+			if(!r.readUInt(id)) return truncated();
+			if(id > maxId) return invalidId("rule", id);
+			if(!r.readString(name)) return truncated();
+			rulesParsed.emplace_back(id, std::move(name));
+		}
+		// id, numEdgeRules, and numAdj
+		if(!r.canHold(numEdges, 3 * intSize)) return truncated();
+		edges.reserve(numEdges);
+		for(std::uint64_t i = 0; i < numEdges; ++i) {
+			std::uint64_t id, numEdgeRules, numAdj;
+			if(!r.readUInt(id)) return truncated();
+			if(id > maxId) return invalidId("edge", id);
+			if(!r.readUInt(numEdgeRules)) return truncated();
+			std::vector<unsigned int> ruleIds;
+			if(!r.canHold(numEdgeRules, intSize)) return truncated();
+			ruleIds.reserve(numEdgeRules);
+			for(std::uint64_t j = 0; j < numEdgeRules; ++j) {
+				std::uint64_t ruleId;
+				if(!r.readUInt(ruleId)) return truncated();
+				if(ruleId > maxId) return invalidId("rule", ruleId);
+				ruleIds.push_back(ruleId);
+			}
+			if(!r.readUInt(numAdj)) return truncated();
+			std::vector<int> adj;
+			if(!r.canHold(numAdj, intSize)) return truncated();
+			adj.reserve(numAdj);
+			for(std::uint64_t j = 0; j < numAdj; ++j) {
+				std::int64_t a;
+				if(!r.readInt(a)) return truncated();
+				if(a < std::numeric_limits<int>::min() || a > std::numeric_limits<int>::max()) {
+					err << "Parsed data is corrupt, invalid vertex reference, " << a << ", in edge " << id << "." << std::endl;
+					return false;
+				}
+				adj.push_back(a);
+			}
+			edges.emplace_back(id, std::move(ruleIds), std::move(adj));
+		}
+		return true;
+	}
+
+	bool checkIds(std::ostream &err) {
+		std::unordered_set<unsigned int> validVertices, validRules;
+		validVertices.reserve(vertices.size());
+		for(const auto &v : vertices)
+			validVertices.insert(v.id);
+		validRules.reserve(rulesParsed.size());
+		for(const auto &r : rulesParsed) {
+			const auto id = get<0>(r);
+			if(validRules.find(id) != end(validRules)) {
+				err << "Parsed data is corrupt, duplicate rule id, " << id << std::endl;
+				return false;
+			}
+			validRules.insert(id);
+		}
+		for(const auto &e : edges) {
+			const auto id = get<0>(e);
+			for(const auto rId : get<1>(e)) {
+				if(validRules.find(rId) == end(validRules)) {
+					err << "Parsed data is corrupt, ruleId, " << rId << ", out of range [0, " << rulesParsed.size()
+					    << "[ for edge " << id << std::endl;
+					return false;
+				}
+			}
+			for(int a : get<2>(e)) {
+				if(a == 0) {
+					err << "Parsed data is corrut, adjacency is 0 for edge " << id << std::endl;
+					return false;
+				}
+				if(validVertices.find(std::abs(a) - 1) == end(validVertices)) {
+					err << "Parsed data is corrupt, adjacency, " << a << ", is not a valid vertex for edge " << id
+					    << std::endl;
+					return false;
+				}
+				if(std::abs(a) - 1 >= static_cast<int> (id)) {
+					err << "Parsed data is corrupt, adjacency " << a << " for edge " << id << " is too large." << std::endl;
+					return false;
+				}
+			}
+		}
+		using Edge = decltype(edges)::value_type;
+		std::sort(begin(vertices), end(vertices), [](const VertexData &a, const VertexData &b) {
+			return a.id < b.id;
+		});
+		std::sort(begin(edges), end(edges), [](const Edge &a, const Edge &b) {
+			return get<0>(a) < get<0>(b);
+		});
+		const auto n = vertices.size() + edges.size();
+		std::vector<bool> used(n, false);
+		for(const auto &v : vertices) {
+			const auto id = v.id;
+			if(id >= n) {
+				err << "Parsed data is corrupt, vertex id " << id << " is out of range (n=" << n << ")." << std::endl;
+				return false;
+			}
+			if(used[id]) {
+				err << "Parsed data is corrupt, vertex id " << id << " is duplicated." << std::endl;
+				return false;
+			}
+			used[id] = true;
+		}
+		for(const auto &e : edges) {
+			const auto id = get<0>(e);
+			if(id >= n) {
+				err << "Parsed data is corrupt, edge id " << id << " is out of range (n=" << n << ")." << std::endl;
+				return false;
+			}
+			if(used[id]) {
+				err << "Parsed data is corrupt, edge id " << id << " is duplicated." << std::endl;
+				return false;
+			}
+			used[id] = true;
+		}
+		for(unsigned int i = 0; i < used.size(); i++) {
+			if(!used[i]) {
+				err << "Parsed data is corrupt, id " << i << " is unused." << std::endl;
+				return false;
+			}
+		}
+		return true;
+	}
+private:
+	boost::optional<std::size_t> keySignature; // only set for binary dumps
+	std::vector<VertexData> vertices;
+	std::vector<std::tuple<unsigned int, std::string> > rulesParsed;
+	std::vector<std::tuple<unsigned int, std::vector<unsigned int>, std::vector<int> > > edges;
+};
+
+namespace {
+
+struct NonHyperDump : public NonHyper {
+	NonHyperDump(const std::vector<std::shared_ptr<graph::Graph> > &graphs,
+	             const std::vector<std::shared_ptr<rule::Rule> > &rules,
+	             Loader &loader)
+			: NonHyper({LabelType::String, LabelRelation::Isomorphism}, graphs, IsomorphismPolicy::Check) {
+		calculatePrologue();
+		constexpr bool printInfo = true;
+		this->rules = loader.apply(*this, rules, printInfo);
 		calculateEpilogue();
 	}
 private:
@@ -132,31 +526,33 @@ private:
 	std::vector<std::shared_ptr<rule::Rule> > rules;
 };
 
-template<typename Iter>
-auto makePosIter(Iter iter) {
-	return IO::PositionIter<Iter>(iter);
+template<typename F>
+void forEachDumpRule(const NonHyper &dgNonHyper, F f) {
+	const auto &dgHyper = dgNonHyper.getHyper();
+	const auto &dg = dgHyper.getGraph();
+	std::set<const lib::Rules::Real *, lib::Rules::LessById> rules;
+	for(const auto v : asRange(vertices(dg))) {
+		if(dg[v].kind != HyperVertexKind::Edge) continue;
+		for(const auto *r : dgHyper.getRulesFromEdge(v))
+			rules.insert(r);
+	}
+	for(const auto *r : rules) f(r);
 }
 
-template<typename Iter, typename Parser, typename Attr>
-bool parse(Iter &textFirst,
-           IO::PositionIter<Iter> &first,
-           const IO::PositionIter<Iter> &last,
-           const Parser &p,
-           Attr &attr,
-           std::ostream &err) {
-	try {
-		bool res = IO::detail::ParseDispatch<x3::space_type>::parse(first, last, p, attr, x3::space);
-		if(!res) {
-			err << "Error while parsing DG dump.\n";
-			IO::detail::doParserError(textFirst, first, last, lib::IO::log());
-			return false;
-		}
-		return res;
-	} catch(const x3::expectation_failure<IO::PositionIter<Iter>> &e) {
-		err << "Error while parsing DG dump.\n";
-		IO::detail::doParserExpectationError(e, textFirst, last, err);
-		return false;
+std::vector<int> getAdjacency(const HyperGraphType &dg, HyperVertex v) {
+	std::vector<int> coefs;
+	for(const auto e : asRange(in_edges(v, dg))) {
+		const auto v = source(e, dg);
+		const auto id = 1 + get(boost::vertex_index_t(), dg, v);
+		coefs.push_back(-id);
+	}
+	for(const auto e : asRange(out_edges(v, dg))) {
+		const auto v = target(e, dg);
+		const auto id = 1 + get(boost::vertex_index_t(), dg, v);
+		coefs.push_back(id);
 	}
+	std::sort(begin(coefs), end(coefs));
+	return coefs;
 }
 
 } // namespace
@@ -165,176 +561,43 @@ std::unique_ptr<NonHyper> load(const std::vector<std::shared_ptr<graph::Graph> >
                                const std::vector<std::shared_ptr<rule::Rule> > &rules,
                                const std::string &file,
                                std::ostream &err) {
-	boost::iostreams::mapped_file_source ifs(file);
-
-	auto textFirst = ifs.begin();
-	const auto textLast = ifs.end();
-	auto first = makePosIter(textFirst);
-	const auto last = makePosIter(textLast);
-
-	unsigned int numVertices, numEdges, numRules;
-	std::vector<std::tuple<
-			unsigned int,
-			std::string,
-			std::unique_ptr<lib::Graph::GraphType>,
-			std::unique_ptr<lib::Graph::PropString>
-	>> vertices;
-	std::vector<std::tuple<unsigned int, std::string> > rulesParsed;
-	std::vector<std::tuple<unsigned int, std::vector<unsigned int>, std::vector<int> > > edges;
+	Loader loader;
+	if(!loader.parse(file, err)) return nullptr;
+	return std::make_unique<NonHyperDump>(graphs, rules, loader);
+}
 
-	std::unordered_set<unsigned int> validVertices, validRules;
-#define PARSE(p, a) if(!parse(textFirst, first, last, p, a, err)) return nullptr
-#define TRY_PARSE(p, a) parse(textFirst, first, last, p, a, err)
-	unsigned int version = 1;
-	TRY_PARSE("version:" >> x3::uint_, version);
-	PARSE("numVertices:" >> x3::uint_, numVertices);
-	PARSE("numEdges:" >> x3::uint_, numEdges);
-	PARSE("numRules:" >> x3::uint_, numRules);
-	vertices.reserve(numVertices);
-	validVertices.reserve(numVertices);
-	for(unsigned int i = 0; i < numVertices; i++) {
-		unsigned int id;
-		std::string name, dfs;
-		PARSE("vertex:" >> x3::uint_, id);
-		PARSE('"' >> x3::lexeme[*(x3::char_ - '"') >> '"'], name);
-		PARSE('"' >> x3::lexeme[*(x3::char_ - '"') >> '"'], dfs);
-		auto gData = IO::Graph::Read::dfs(dfs, err);
-		if(!gData.g) {
-			err << "GraphDFS \"" << dfs << "\" could not be parsed for vertex " << id << std::endl;
-			return nullptr;
-		}
-		if(gData.pStereo) MOD_ABORT;
-		vertices.emplace_back(id, std::move(name), std::move(gData.g), std::move(gData.pString));
-		validVertices.insert(id);
-	}
-	rulesParsed.reserve(numRules);
-	validRules.reserve(numRules);
-	for(unsigned int i = 0; i < numRules; i++) {
-		unsigned int id;
-		std::string name;
-		PARSE("rule:" >> x3::uint_, id);
-		PARSE('"' >> x3::lexeme[*(x3::char_ - '"') >> '"'], name);
-		rulesParsed.emplace_back(id, std::move(name));
-		if(validRules.find(id) != end(validRules)) {
-			err << "Parsed data is corrupt, duplicate rule id, " << id << std::endl;
-			return nullptr;
-		}
-		validRules.insert(id);
-	}
-	edges.reserve(numEdges);
-	std::vector<int> adj;
-	adj.reserve(numVertices); // probably a huge overestimation
-	for(unsigned int i = 0; i < numEdges; i++) {
-		unsigned int id;
-		std::vector<unsigned int> ruleIds;
-		PARSE("edge:" >> x3::uint_, id);
-		unsigned int numRules;
-		if(version == 1) numRules = 1;
-		else PARSE(x3::uint_, numRules);
-		ruleIds.reserve(numRules);
-		for(std::size_t i = 0; i < numRules; ++i) {
-			unsigned int ruleId;
-			PARSE(x3::uint_, ruleId);
-			ruleIds.push_back(ruleId);
-		}
-		PARSE(*x3::int_, adj);
-		for(const auto rId : ruleIds) {
-			if(validRules.find(rId) == end(validRules)) {
-				err << "Parsed data is corrupt, ruleId, " << rId << ", out of range [0, " << numRules << "[ for edge " << id
-				    << std::endl;
-				return nullptr;
-			}
-		}
-		for(int a : adj) {
-			if(a == 0) {
-				err << "Parsed data is corrut, adjacency is 0 for edge " << id << std::endl;
-				return nullptr;
-			}
-			if(validVertices.find(std::abs(a) - 1) == end(validVertices)) {
-				err << "Parsed data is corrupt, adjacency, " << a << ", is not a valid vertex for edge " << id << std::endl;
-				return nullptr;
-			}
-			if(std::abs(a) - 1 >= static_cast<int> (id)) {
-				err << "Parsed data is corrupt, adjacency " << a << " for edge " << id << " is too large." << std::endl;
-				return nullptr;
-			}
-		}
-		edges.emplace_back(id, std::move(ruleIds), adj);
-		adj.clear();
-	}
-	using Vertex = decltype(vertices)::value_type;
-	using Edge = decltype(edges)::value_type;
-	std::sort(begin(vertices), end(vertices), [](const Vertex &a, const Vertex &b) {
-		return get<0>(a) < get<0>(b);
-	});
-	std::sort(begin(edges), end(edges), [](const Edge &a, const Edge &b) {
-		return get<0>(a) < get<0>(b);
-	});
-	const auto n = vertices.size() + edges.size();
-	std::vector<bool> used(n, false);
-	for(const auto &v : vertices) {
-		const auto id = get<0>(v);
-		if(id >= n) {
-			err << "Parsed data is corrupt, vertex id " << id << " is out of range (n=" << n << ")." << std::endl;
-			return nullptr;
-		}
-		if(used[id]) {
-			err << "Parsed data is corrupt, vertex id " << id << " is duplicated." << std::endl;
-			return nullptr;
-		}
-		used[id] = true;
-	}
-	for(const auto &e : edges) {
-		const auto id = get<0>(e);
-		if(id >= n) {
-			err << "Parsed data is corrupt, edge id " << id << " is out of range (n=" << n << ")." << std::endl;
-			return nullptr;
-		}
-		if(used[id]) {
-			err << "Parsed data is corrupt, edge id " << id << " is duplicated." << std::endl;
-			return nullptr;
-		}
-		used[id] = true;
-	}
-	for(unsigned int i = 0; i < used.size(); i++) {
-		if(!used[i]) {
-			err << "Parsed data is corrupt, id " << i << " is unused." << std::endl;
-			return nullptr;
-		}
-	}
-	return std::make_unique<NonHyperDump>(
-			graphs,
-			ConstructionData{rules, std::move(vertices), std::move(rulesParsed), std::move(edges)});
+boost::optional<std::vector<std::shared_ptr<rule::Rule> > >
+loadInto(NonHyper &dg,
+         const std::vector<std::shared_ptr<rule::Rule> > &rules,
+         const std::string &file,
+         std::ostream &err,
+         bool printInfo) {
+	Loader loader;
+	if(!loader.parse(file, err)) return boost::none;
+	return loader.apply(dg, rules, printInfo);
 }
 
 void write(const NonHyper &dgNonHyper, std::ostream &s) {
 	if(dgNonHyper.getLabelSettings().withStereo) {
 		throw mod::LogicError("Can not yet dump DGs with stereo data.");
 	}
-	using Vertex = lib::DG::HyperVertex;
-	using Edge = lib::DG::HyperEdge;
 	using VertexKind = lib::DG::HyperVertexKind;
 	const auto &dgHyper = dgNonHyper.getHyper();
 	const auto &dg = dgHyper.getGraph();
-	int numVertices = 0, numEdges = 0;
+	int numVertices = 0, numEdges = 0, numRules = 0;
 
 	for(const auto v : asRange(vertices(dg))) {
 		if(dg[v].kind == VertexKind::Vertex) numVertices++;
 		else numEdges++;
 	}
-
-	std::set<const lib::Rules::Real *, lib::Rules::LessById> rules;
-
-	for(const auto v : asRange(vertices(dg))) {
-		if(dg[v].kind != VertexKind::Edge) continue;
-		for(const auto *r : dgHyper.getRulesFromEdge(v))
-			rules.insert(r);
-	}
+	forEachDumpRule(dgNonHyper, [&numRules](const lib::Rules::Real *) {
+		++numRules;
+	});
 
 	s << "version:\t2\n";
 	s << "numVertices:\t" << numVertices << "\n";
 	s << "numEdges:\t" << numEdges << "\n";
-	s << "numRules:\t" << rules.size() << "\n";
+	s << "numRules:\t" << numRules << "\n";
 
 	for(const auto v : asRange(vertices(dg))) {
 		if(dg[v].kind != VertexKind::Vertex) continue;
@@ -344,7 +607,9 @@ void write(const NonHyper &dgNonHyper, std::ostream &s) {
 		s << "vertex:\t" << id << "\t\"" << g->getName() << "\"\t\"" << g->getGraphDFS().first << "\"\n";
 	}
 
-	for(const auto *r : rules) s << "rule:\t" << r->getId() << "\t\"" << r->getName() << "\"\n";
+	forEachDumpRule(dgNonHyper, [&s](const lib::Rules::Real *r) {
+		s << "rule:\t" << r->getId() << "\t\"" << r->getName() << "\"\n";
+	});
 
 	for(const auto v : asRange(vertices(dg))) {
 		if(dg[v].kind != VertexKind::Edge) continue;
@@ -354,26 +619,81 @@ void write(const NonHyper &dgNonHyper, std::ostream &s) {
 		for(const auto *r : rules)
 			s << " " << r->getId();
 		s << "\t";
+		for(int coef : getAdjacency(dg, v)) s << coef << " ";
+		s << "\n";
+	}
+}
 
-		std::vector<int> coefs;
-		for(const auto e : asRange(in_edges(v, dg))) {
-			const auto v = source(e, dg);
-			const auto id = 1 + get(boost::vertex_index_t(), dg, v);
-			coefs.push_back(-id);
-		}
-		for(const auto e : asRange(out_edges(v, dg))) {
-			const auto v = target(e, dg);
-			const auto id = 1 + get(boost::vertex_index_t(), dg, v);
-			coefs.push_back(id);
+void writeBinary(const NonHyper &dgNonHyper, std::ostream &s) {
+	if(dgNonHyper.getLabelSettings().withStereo) {
+		throw mod::LogicError("Can not yet dump DGs with stereo data.");
+	}
+	using VertexKind = lib::DG::HyperVertexKind;
+	const auto &dgHyper = dgNonHyper.getHyper();
+	const auto &dg = dgHyper.getGraph();
+	const auto &graphDatabase = dgNonHyper.getGraphDatabase();
+	std::uint64_t numVertices = 0, numEdges = 0, numRules = 0;
+
+	for(const auto v : asRange(vertices(dg))) {
+		if(dg[v].kind == VertexKind::Vertex) numVertices++;
+		else numEdges++;
+	}
+	forEachDumpRule(dgNonHyper, [&numRules](const lib::Rules::Real *) {
+		++numRules;
+	});
+
+	BinaryWriter w(s);
+	s.write(binaryMagic, sizeof(binaryMagic));
+	w.writeUInt(binaryVersion);
+	w.writeUInt(byteOrderProbe);
+	w.writeUInt(graphDatabase.getKeySignature());
+	w.writeUInt(numVertices);
+	w.writeUInt(numRules);
+	w.writeUInt(numEdges);
+
+	for(const auto v : asRange(vertices(dg))) {
+		if(dg[v].kind != VertexKind::Vertex) continue;
+		const lib::Graph::Single *g = dg[v].graph;
+		assert(g);
+		const auto &graph = g->getGraph();
+		const auto &pString = g->getStringState();
+		w.writeUInt(get(boost::vertex_index_t(), dg, v));
+		w.writeString(g->getName());
+		w.writeUInt(num_vertices(graph));
+		for(const auto vG : asRange(vertices(graph)))
+			w.writeString(pString[vG]);
+		w.writeUInt(num_edges(graph));
+		for(const auto eG : asRange(edges(graph))) {
+			w.writeUInt(get(boost::vertex_index_t(), graph, source(eG, graph)));
+			w.writeUInt(get(boost::vertex_index_t(), graph, target(eG, graph)));
+			w.writeString(pString[eG]);
 		}
-		std::sort(begin(coefs), end(coefs));
-		for(int coef : coefs) s << coef << " ";
+		const auto stats = graphDatabase.getStats(g);
+		w.writeUInt(stats.numVertices);
+		w.writeUInt(stats.numEdges);
+		w.writeUInt(stats.invariant);
+	}
 
-		s << "\n";
+	forEachDumpRule(dgNonHyper, [&w](const lib::Rules::Real *r) {
+		w.writeUInt(r->getId());
+		w.writeString(r->getName());
+	});
+
+	for(const auto v : asRange(vertices(dg))) {
+		if(dg[v].kind != VertexKind::Edge) continue;
+		w.writeUInt(get(boost::vertex_index_t(), dg, v));
+		const auto &rules = dgHyper.getRulesFromEdge(v);
+		w.writeUInt(rules.size());
+		for(const auto *r : rules)
+			w.writeUInt(r->getId());
+		const auto adj = getAdjacency(dg, v);
+		w.writeUInt(adj.size());
+		for(int a : adj)
+			w.writeInt(a);
 	}
 }
 
 } // namespace Dump
 } // namespace DG
 } // namespace lib
-} // namespace mod
\ No newline at end of file
+} // namespace mod
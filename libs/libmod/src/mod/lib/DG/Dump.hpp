@@ -4,6 +4,8 @@
 #include <mod/graph/ForwardDecl.hpp>
 #include <mod/rule/ForwardDecl.hpp>
 
+#include <boost/optional/optional.hpp>
+
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -15,11 +17,27 @@ namespace DG {
 class NonHyper;
 namespace Dump {
 
+struct Loader;
+
+// Both loading functions accept the text format from write and the binary format from writeBinary.
+// Graphs are linked to isomorphic graphs already in the DG, and rules are linked by name.
 std::unique_ptr<NonHyper> load(const std::vector<std::shared_ptr<graph::Graph> > &graphs,
 										 const std::vector<std::shared_ptr<rule::Rule> > &rules,
 										 const std::string &file,
 										 std::ostream &err);
+// Adds the content of the dump to a DG under construction.
+// Returns the linked rules, or none if the file could not be parsed, with the reason written to err.
+// Throws InputError if a rule in the dump is not among the given rules.
+boost::optional<std::vector<std::shared_ptr<rule::Rule> > >
+loadInto(NonHyper &dg,
+         const std::vector<std::shared_ptr<rule::Rule> > &rules,
+         const std::string &file,
+         std::ostream &err,
+         bool printInfo);
 void write(const NonHyper &dg, std::ostream &s);
+// As write, but in a binary format which also stores the key of each graph in the graph database,
+// so loading into a DG with the same settings skips the hashing of the graphs.
+void writeBinary(const NonHyper &dg, std::ostream &s);
 
 } // namespace Dump
 } // namespace DG
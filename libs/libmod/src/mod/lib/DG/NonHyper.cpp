@@ -26,13 +26,14 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/make_shared.hpp>
 
+#include <atomic>
 #include <unordered_set>
 
 namespace mod {
 namespace lib {
 namespace DG {
 namespace {
-std::size_t nextDGNum = 0;
+std::atomic<std::size_t> nextDGNum(0);
 }// namespace 
 
 NonHyper::NonHyper(LabelSettings labelSettings,
@@ -163,6 +164,24 @@ std::pair<std::shared_ptr<graph::Graph>, bool> NonHyper::checkIfNew(std::unique_
 	return {g, true};
 }
 
+std::pair<std::shared_ptr<graph::Graph>, bool>
+NonHyper::checkIfNew(std::unique_ptr<lib::Graph::Single> gCand, Graph::CollectionStats stats) const {
+	assert(gCand);
+	{
+		const auto g = graphDatabase.findIsomorphic(gCand.get(), stats);
+		if(g) return {g, false};
+	}
+	std::shared_ptr<graph::Graph> g = graph::Graph::makeGraph(std::move(gCand));
+	return {g, true};
+}
+
+bool NonHyper::trustAddGraphAsVertex(std::shared_ptr<graph::Graph> g, Graph::CollectionStats stats) {
+	if(getHasCalculated()) std::abort();
+	bool inserted = graphDatabase.trustInsert(g, stats);
+	getVertex(GraphMultiset(&g->getGraph()));
+	return inserted;
+}
+
 void NonHyper::giveProductStatus(std::shared_ptr<graph::Graph> g) {
 	assert(graphDatabase.contains(g));
 
@@ -25,9 +25,13 @@ struct PropString;
 } // namespace Graph
 namespace DG {
 class HyperCreator;
+namespace Dump {
+struct Loader;
+} // namespace Dump
 
 class NonHyper {
 	friend class HyperCreator;
+	friend struct Dump::Loader;
 public:
 	using GraphType = NonHyperGraphType;
 	using Vertex = NonHyperVertex;
@@ -73,6 +77,11 @@ protected: // calculation
 	// If not found, returns the given wrapped given graph and true.
 	// Does NOT change the graphDatabse.
 	std::pair<std::shared_ptr<graph::Graph>, bool> checkIfNew(std::unique_ptr<lib::Graph::Single> g) const;
+	// As checkIfNew and trustAddGraphAsVertex, but with the precomputed key of g in the graph database,
+	// see Graph::Collection::getStats.
+	std::pair<std::shared_ptr<graph::Graph>, bool>
+	checkIfNew(std::unique_ptr<lib::Graph::Single> g, Graph::CollectionStats stats) const;
+	bool trustAddGraphAsVertex(std::shared_ptr<graph::Graph> g, Graph::CollectionStats stats);
 	// Gives a graph product status, i.e., rename it,
 	// put it in the product list and maybe print a status message.
 	void giveProductStatus(std::shared_ptr<graph::Graph> g);
@@ -4,14 +4,18 @@
 #include <mod/Function.hpp>
 #include <mod/Misc.hpp>
 #include <mod/rule/Rule.hpp>
+#include <mod/lib/DG/Dump.hpp>
 #include <mod/lib/DG/RuleApplicationUtils.hpp>
 #include <mod/lib/DG/Strategies/GraphState.hpp>
 #include <mod/lib/DG/Strategies/Strategy.hpp>
+#include <mod/lib/Graph/IsomorphismCallCounter.hpp>
 #include <mod/lib/Graph/Properties/Term.hpp>
+#include <mod/lib/Graph/Single.hpp>
 #include <mod/lib/IO/DG.hpp>
 #include <mod/lib/IO/IO.hpp>
 #include <mod/lib/RC/ComposeRuleReal.hpp>
 #include <mod/lib/RC/MatchMaker/Super.hpp>
+#include <mod/lib/Stopwatch.hpp>
 
 #include <boost/lexical_cast.hpp>
 
@@ -98,8 +102,8 @@ std::pair<NonHyper::Edge, bool> Builder::addDerivation(const Derivations &d, Iso
 }
 
 struct NonHyperBuilder::ExecutionEnv final : public Strategies::ExecutionEnv {
-	ExecutionEnv(NonHyperBuilder &owner, LabelSettings labelSettings)
-			: Strategies::ExecutionEnv(labelSettings), owner(owner) {}
+	ExecutionEnv(NonHyperBuilder &owner, LabelSettings labelSettings, dg::RuleApplicationEngine ruleApplicationEngine)
+			: Strategies::ExecutionEnv(labelSettings, ruleApplicationEngine), owner(owner) {}
 
 	void tryAddGraph(std::shared_ptr<graph::Graph> gCand) override {
 		owner.tryAddGraph(gCand);
@@ -134,7 +138,10 @@ struct NonHyperBuilder::ExecutionEnv final : public Strategies::ExecutionEnv {
 	}
 
 	virtual std::shared_ptr<graph::Graph> checkIfNew(std::unique_ptr<lib::Graph::Single> g) const override {
-		return owner.checkIfNew(std::move(g)).first;
+		const Stopwatch stopwatch;
+		auto res = owner.checkIfNew(std::move(g)).first;
+		statistics.productLookupTime += stopwatch.seconds();
+		return res;
 	}
 
 	void giveProductStatus(std::shared_ptr<graph::Graph> g) override {
@@ -151,6 +158,11 @@ struct NonHyperBuilder::ExecutionEnv final : public Strategies::ExecutionEnv {
 		return isProduct;
 	}
 
+	CompositionCache *getCompositionCache() override {
+		if(!getConfig().dg.useCompositionCache.get()) return nullptr;
+		return &owner.compositionCache;
+	}
+
 	bool isDerivation(const GraphMultiset &gmsSrc,
 							const GraphMultiset &gmsTar,
 							const lib::Rules::Real *r) const override {
@@ -163,6 +175,30 @@ struct NonHyperBuilder::ExecutionEnv final : public Strategies::ExecutionEnv {
 		return owner.suggestDerivation(gmsSrc, gmsTar, r).second;
 	}
 
+	void addRuleStatistics(const dg::ExecuteStatistics::RuleStatistics &stats) override {
+		assert(stats.rule);
+		const auto iter = ruleStatistics.find(stats.rule->getId());
+		if(iter != ruleStatistics.end()) {
+			statistics.rules[iter->second].add(stats);
+		} else {
+			ruleStatistics.emplace(stats.rule->getId(), statistics.rules.size());
+			statistics.rules.push_back(stats);
+		}
+	}
+
+	void addStrategyTime(const char *kind, double time) override {
+		auto iter = std::find_if(statistics.strategies.begin(), statistics.strategies.end(),
+		                         [kind](const dg::ExecuteStatistics::StrategyStatistics &s) {
+			                         return s.kind == kind;
+		                         });
+		if(iter == statistics.strategies.end()) {
+			statistics.strategies.push_back({kind, 0, 0});
+			iter = statistics.strategies.end() - 1;
+		}
+		++iter->executions;
+		iter->time += time;
+	}
+
 	void pushLeftPredicate(std::shared_ptr<mod::Function<bool(const mod::Derivation &)> > pred) override {
 		leftPredicates.push_back(pred);
 	}
@@ -181,16 +217,25 @@ struct NonHyperBuilder::ExecutionEnv final : public Strategies::ExecutionEnv {
 
 public:
 	NonHyperBuilder &owner;
+	mutable dg::ExecuteStatistics statistics;
+private:
+	// rule id -> index into statistics.rules
+	std::unordered_map<std::size_t, std::size_t> ruleStatistics;
 private: // state for computation
 	std::vector<std::shared_ptr<mod::Function<bool(const mod::Derivation &)> > > leftPredicates;
 	std::vector<std::shared_ptr<mod::Function<bool(const mod::Derivation &)> > > rightPredicates;
 	bool doExit_ = false;
 };
 
+const dg::ExecuteStatistics &ExecuteResult::getStatistics() const {
+	return owner->executions[execution].env->statistics;
+}
+
 ExecuteResult
-Builder::execute(std::unique_ptr<Strategies::Strategy> strategy_, int verbosity, bool ignoreRuleLabelTypes) {
+Builder::execute(std::unique_ptr<Strategies::Strategy> strategy_, int verbosity, bool ignoreRuleLabelTypes,
+                 dg::RuleApplicationEngine engine) {
 	NonHyperBuilder::StrategyExecution exec{
-			std::make_unique<NonHyperBuilder::ExecutionEnv>(*dg, dg->getLabelSettings()),
+			std::make_unique<NonHyperBuilder::ExecutionEnv>(*dg, dg->getLabelSettings(), engine),
 			std::make_unique<Strategies::GraphState>(),
 			std::move(strategy_)
 	};
@@ -226,7 +271,23 @@ Builder::execute(std::unique_ptr<Strategies::Strategy> strategy_, int verbosity,
 		});
 	}
 
+	const Stopwatch stopwatch;
+	// only the calls of this execution, also with concurrent builds in other threads
+	const lib::Graph::IsomorphismCallCounter isomorphismCalls;
+	const auto numProductsBefore = dg->getProducts().size();
 	exec.strategy->execute(Strategies::PrintSettings(IO::log(), false, verbosity), *exec.input);
+	// with multiple threads, compute the canonical data of the new products which the isomorphism checks use
+	// in bulk, instead of one at a time on later lookups
+	if(getConfig().dg.canonicaliseProducts.get() && getConfig().common.numThreads.get() > 1) {
+		const auto &products = dg->getProducts();
+		std::vector<const lib::Graph::Single *> newProducts;
+		newProducts.reserve(products.size() - numProductsBefore);
+		for(auto iter = products.begin() + numProductsBefore; iter != products.end(); ++iter)
+			newProducts.push_back(&(*iter)->getGraph());
+		lib::Graph::canonicaliseForIsomorphism(newProducts, dg->getLabelSettings());
+	}
+	exec.env->statistics.time = stopwatch.seconds();
+	exec.env->statistics.isomorphismCalls = isomorphismCalls.get();
 	dg->executions.push_back(std::move(exec));
 	return ExecuteResult(dg, dg->executions.size() - 1);
 }
@@ -286,6 +347,14 @@ void Builder::addAbstract(const std::string &description) {
 	}
 }
 
+void Builder::load(const std::vector<std::shared_ptr<rule::Rule> > &ruleDatabase,
+                   const std::string &file, int verbosity) {
+	std::ostringstream err;
+	auto rules = Dump::loadInto(*dg, ruleDatabase, file, err, verbosity >= 2);
+	if(!rules) throw InputError("Could not load DG dump.\n" + err.str());
+	dg->rules.insert(rules->begin(), rules->end());
+}
+
 // -----------------------------------------------------------------------------
 
 NonHyperBuilder::NonHyperBuilder(LabelSettings labelSettings,
@@ -2,6 +2,9 @@
 #define MOD_LIB_DG_NONHYPERBUILDER_H
 
 #include <mod/Derivation.hpp>
+#include <mod/dg/Builder.hpp>
+#include <mod/dg/ExecuteStatistics.hpp>
+#include <mod/lib/DG/CompositionCache.hpp>
 #include <mod/lib/DG/NonHyper.hpp>
 
 namespace mod {
@@ -14,6 +17,7 @@ struct GraphState;
 struct ExecuteResult {
 	ExecuteResult(NonHyperBuilder *owner, int execution);
 	const Strategies::GraphState &getResult() const;
+	const dg::ExecuteStatistics &getStatistics() const;
 	void list(bool withUniverse) const;
 private:
 	NonHyperBuilder *owner;
@@ -30,8 +34,11 @@ public:
 	// pre: !d.right.empty()
 	std::pair<NonHyper::Edge, bool> addDerivation(const Derivations &d, IsomorphismPolicy graphPolicy);
 	// pre: strategy must not have been executed before (i.e., a newly constructed strategy, or a clone)
-	ExecuteResult execute(std::unique_ptr<Strategies::Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes);
+	ExecuteResult execute(std::unique_ptr<Strategies::Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes,
+	                      dg::RuleApplicationEngine engine);
 	void addAbstract(const std::string &description);
+	// see Dump::loadInto
+	void load(const std::vector<std::shared_ptr<rule::Rule> > &ruleDatabase, const std::string &file, int verbosity);
 private:
 	NonHyperBuilder *dg;
 };
@@ -53,6 +60,8 @@ private:
 		std::unique_ptr<Strategies::Strategy> strategy;
 	};
 	std::vector<StrategyExecution> executions;
+	// shared by all executions, see config.dg.useCompositionCache
+	CompositionCache compositionCache;
 };
 
 } // namespace DG
@@ -8,6 +8,10 @@
 #include <mod/lib/Rules/Real.hpp>
 #include <mod/lib/Stereo/CloneUtil.hpp>
 
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
 namespace mod {
 namespace lib {
 namespace DG {
@@ -15,6 +19,55 @@ namespace DG {
 struct BoundRule {
 	const lib::Rules::Real *rule;
 	std::vector<const lib::Graph::Single *> boundGraphs;
+	// false if the rule is not owned by the binding procedure,
+	// i.e., it is the input rule or it is owned by a CompositionCache
+	bool owned = true;
+};
+
+// Indexes intermediary rules by the multiset of bound graphs and an isomorphism invariant,
+// such that duplicate detection only needs isomorphism checks for the rules which have the same key.
+struct BoundRuleIndex {
+	BoundRuleIndex(LabelType labelType, bool withStereo) : labelType(labelType), withStereo(withStereo) {}
+
+	// Adds the rule if it is not isomorphic to a previously added rule with the same multiset of bound graphs.
+	// Returns whether it was added.
+	// pre: brp.boundGraphs is sorted by id
+	bool tryAdd(const BoundRule &brp) {
+		Key key{{}, lib::Rules::Real::isomorphismInvariant(*brp.rule, labelType)};
+		key.graphIds.reserve(brp.boundGraphs.size());
+		for(const lib::Graph::Single *g : brp.boundGraphs)
+			key.graphIds.push_back(g->getId());
+		auto &bucket = entries[std::move(key)];
+		const auto isomorphic = lib::Rules::makeIsomorphismPredicate(labelType, withStereo);
+		for(const lib::Rules::Real *rOther : bucket) {
+			if(isomorphic(brp.rule, rOther)) return false;
+		}
+		bucket.push_back(brp.rule);
+		return true;
+	}
+
+private:
+	struct Key {
+		std::vector<std::size_t> graphIds;
+		std::size_t ruleInvariant;
+	public:
+		friend bool operator==(const Key &a, const Key &b) {
+			return a.ruleInvariant == b.ruleInvariant && a.graphIds == b.graphIds;
+		}
+	};
+
+	struct KeyHash {
+		std::size_t operator()(const Key &k) const {
+			std::size_t res = k.ruleInvariant;
+			for(const std::size_t id : k.graphIds)
+				boost::hash_combine(res, id);
+			return res;
+		}
+	};
+private:
+	const LabelType labelType;
+	const bool withStereo;
+	std::unordered_map<Key, std::vector<const lib::Rules::Real *>, KeyHash> entries;
 };
 
 struct BoundRuleStorage {
@@ -24,46 +77,23 @@ struct BoundRuleStorage {
 						  std::vector<BoundRule> &ruleStore,
 						  const BoundRule &rule,
 						  const lib::Graph::Single *graph)
-			: verbose(verbose), logger(logger), labelType(labelType), withStereo(withStereo),
+			: verbose(verbose), logger(logger), index(labelType, withStereo),
 			  ruleStore(ruleStore), rule(rule), graph(graph) {}
 
-	void add(lib::Rules::Real *r) {
-		BoundRule p{r, rule.boundGraphs};
+	// With owned == false the rule is not deleted when it is a duplicate.
+	void add(const lib::Rules::Real *r, bool owned = true) {
+		BoundRule p{r, rule.boundGraphs, owned};
 		p.boundGraphs.push_back(graph);
 		bool found = false;
 		const bool doBoundRulesDuplicateCheck = true;
 		// if it's only right side, we will rather split it instead
 		if(doBoundRulesDuplicateCheck && !r->isOnlyRightSide()) {
-			std::vector<const lib::Graph::Single *> &rThis = p.boundGraphs;
-
-			std::sort(begin(rThis), end(rThis), [](const lib::Graph::Single *g1, const lib::Graph::Single *g2) {
-				return g1->getId() < g2->getId();
-			});
-
-			for(BoundRule &rp : ruleStore) {
-				if(rThis.size() != rp.boundGraphs.size()) continue;
-				std::vector<const lib::Graph::Single *> &rOther = rp.boundGraphs;
-
-				std::sort(rOther.begin(), rOther.end(), [](const lib::Graph::Single *g1, const lib::Graph::Single *g2) {
-					return g1->getId() < g2->getId();
-				});
-				bool doContinue = false;
-				for(unsigned int i = 0; i < rThis.size(); i++) {
-					if(rThis[i] != rOther[i]) {
-						doContinue = true;
-						break;
-					}
-				}
-				if(doContinue) continue;
-				found = 1 == lib::Rules::Real::isomorphism(*r, *rp.rule, 1,
-																		 {labelType, LabelRelation::Isomorphism, withStereo,
-																		  LabelRelation::Isomorphism});
-				if(found) break;
-			}
+			sortBoundGraphs(p);
+			found = !index.tryAdd(p);
 		}
 		if(found) {
 			//			IO::log() << "Duplicate BRP found" << std::endl;
-			delete r;
+			if(owned) delete r;
 		} else {
 			ruleStore.push_back(p);
 			if(verbose) {
@@ -76,11 +106,17 @@ struct BoundRuleStorage {
 		}
 	}
 
+	static void sortBoundGraphs(BoundRule &brp) {
+		std::sort(brp.boundGraphs.begin(), brp.boundGraphs.end(),
+		          [](const lib::Graph::Single *g1, const lib::Graph::Single *g2) {
+			          return g1->getId() < g2->getId();
+		          });
+	}
+
 private:
 	const bool verbose;
 	IO::Logger logger;
-	const LabelType labelType;
-	const bool withStereo;
+	BoundRuleIndex index;
 	std::vector<BoundRule> &ruleStore;
 	const BoundRule &rule;
 	const lib::Graph::Single *graph;
@@ -98,6 +134,36 @@ public:
 	std::vector<SideVertex> vertexMap;
 };
 
+// Turns the graphs into products, such that isomorphic graphs are represented by the same product,
+// both with respect to the existing graphs (through checkIfNew) and with respect to each other.
+template<typename CheckIfNew, typename OnDup>
+std::vector<std::shared_ptr<graph::Graph> > wrapProducts(std::vector<GraphData> products,
+                                                         const LabelType labelType,
+                                                         const bool withStereo,
+                                                         CheckIfNew checkIfNew,
+                                                         OnDup onDup) {
+	std::vector<std::shared_ptr<graph::Graph> > right;
+	for(auto &g : products) {
+		// check against the database
+		auto gCand = std::make_unique<lib::Graph::Single>(std::move(g.gPtr), std::move(g.pStringPtr),
+																		  std::move(g.pStereoPtr));
+		std::shared_ptr<graph::Graph> gWrapped = checkIfNew(std::move(gCand));
+		// checkIfNew does not add the graph, so we must check against the previous products as well
+		for(auto gPrev : right) {
+			const auto ls = mod::LabelSettings(labelType, LabelRelation::Isomorphism, withStereo,
+														  LabelRelation::Isomorphism);
+			const bool iso = lib::Graph::Single::isomorphic(gPrev->getGraph(), gWrapped->getGraph(), ls);
+			if(iso) {
+				onDup(gWrapped, gPrev);
+				gWrapped = gPrev;
+				break;
+			}
+		}
+		right.push_back(gWrapped);
+	}
+	return right;
+}
+
 template<typename CheckIfNew, typename OnDup>
 std::vector<std::shared_ptr<graph::Graph> > splitRule(const lib::Rules::LabelledRule &rDPO,
 																		const LabelType labelType,
@@ -167,27 +233,7 @@ std::vector<std::shared_ptr<graph::Graph> > splitRule(const lib::Rules::Labelled
 			p.pStereoPtr = std::make_unique<lib::Graph::PropStereo>(*p.gPtr, inf);
 		} // end foreach product
 	} // end of stereo prop
-	// wrap them
-	std::vector<std::shared_ptr<graph::Graph> > right;
-	for(auto &g : products) {
-		// check against the database
-		auto gCand = std::make_unique<lib::Graph::Single>(std::move(g.gPtr), std::move(g.pStringPtr),
-																		  std::move(g.pStereoPtr));
-		std::shared_ptr<graph::Graph> gWrapped = checkIfNew(std::move(gCand));
-		// checkIfNew does not add the graph, so we must check against the previous products as well
-		for(auto gPrev : right) {
-			const auto ls = mod::LabelSettings(labelType, LabelRelation::Isomorphism, withStereo,
-														  LabelRelation::Isomorphism);
-			const bool iso = lib::Graph::Single::isomorphic(gPrev->getGraph(), gWrapped->getGraph(), ls);
-			if(iso) {
-				onDup(gWrapped, gPrev);
-				gWrapped = gPrev;
-				break;
-			}
-		}
-		right.push_back(gWrapped);
-	}
-	return right;
+	return wrapProducts(std::move(products), labelType, withStereo, checkIfNew, onDup);
 }
 
 } // namespace DG
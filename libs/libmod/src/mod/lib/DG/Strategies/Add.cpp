@@ -2,7 +2,13 @@
 
 #include <mod/Function.hpp>
 #include <mod/graph/Graph.hpp>
+#include <mod/graph/LazyGraph.hpp>
+#include <mod/rule/Rule.hpp>
 #include <mod/lib/DG/Strategies/GraphState.hpp>
+#include <mod/lib/Graph/LabelSummary.hpp>
+
+#include <algorithm>
+#include <iterator>
 
 namespace mod {
 namespace lib {
@@ -18,10 +24,18 @@ Add::Add(const std::shared_ptr<mod::Function<std::vector<std::shared_ptr<graph::
 		: Strategy::Strategy(0),
 		  generator(generator), onlyUniverse(onlyUniverse), graphPolicy(graphPolicy) {}
 
+Add::Add(const std::vector<std::shared_ptr<graph::LazyGraph> > lazyGraphs,
+			const std::vector<std::shared_ptr<rule::Rule> > rules,
+			bool onlyUniverse, IsomorphismPolicy graphPolicy)
+		: Strategy::Strategy(0),
+		  lazyGraphs(lazyGraphs), rules(rules), isLazy(true), onlyUniverse(onlyUniverse), graphPolicy(graphPolicy) {}
+
 Add::~Add() = default;
 
 Strategy *Add::clone() const {
-	if(!generator)
+	if(isLazy)
+		return new Add(lazyGraphs, rules, onlyUniverse, graphPolicy);
+	else if(!generator)
 		return new Add(graphs, onlyUniverse, graphPolicy);
 	else
 		return new Add(generator, onlyUniverse, graphPolicy);
@@ -43,6 +57,13 @@ void Add::printInfo(PrintSettings settings) const {
 		settings.indent() << "function = ";
 		generator->print(s);
 		--settings.indentLevel;
+	} else if(isLazy) {
+		s << " " << lazyGraphs.size() << " lazy graphs";
+		if(!rules.empty()) {
+			s << ", filtered by rules";
+			for(const auto &r : rules)
+				s << " " << r->getName();
+		}
 	} else {
 		for(const auto &g : graphs)
 			s << " " << g->getName();
@@ -66,6 +87,25 @@ void Add::executeImpl(PrintSettings settings, const GraphState &input) {
 	std::vector<std::shared_ptr<graph::Graph> > graphsToAdd;
 	if(generator) {
 		graphsToAdd = (*generator)();
+	} else if(isLazy) {
+		// a graph may match one of the rules iff it may contain a left component of one of them
+		const bool filter = !rules.empty() && getExecutionEnv().labelSettings.type == LabelType::String;
+		std::vector<lib::Graph::LabelSummary> ruleComponents;
+		if(filter) {
+			for(const auto &r : rules) {
+				auto comps = lib::Graph::getLeftComponentSummaries(r->getRule());
+				std::move(comps.begin(), comps.end(), std::back_inserter(ruleComponents));
+			}
+		}
+		for(const auto &lg : lazyGraphs) {
+			if(!filter || lg->mayMatch(ruleComponents))
+				graphsToAdd.push_back(lg->getGraph());
+		}
+		if(settings.verbosity >= PrintSettings::V_Add) {
+			++settings.indentLevel;
+			settings.indent() << "loaded " << graphsToAdd.size() << " of " << lazyGraphs.size() << " lazy graphs" << std::endl;
+			--settings.indentLevel;
+		}
 	} else {
 		graphsToAdd = graphs;
 	}
@@ -93,6 +133,9 @@ void Add::executeImpl(PrintSettings settings, const GraphState &input) {
 		for(const std::shared_ptr<graph::Graph> g : graphsToAdd)
 			output->addToSubset(0, &g->getGraph());
 	}
+	// the derivation graph now owns the loaded graphs
+	for(const auto &lg : lazyGraphs)
+		lg->release();
 }
 
 } // namespace Strategies
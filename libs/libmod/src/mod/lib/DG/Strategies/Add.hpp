@@ -14,17 +14,25 @@ struct Add : Strategy {
 	Add(const std::vector<std::shared_ptr<graph::Graph> > graphs, bool onlyUniverse, IsomorphismPolicy graphPolicy);
 	Add(const std::shared_ptr<mod::Function<std::vector<std::shared_ptr<graph::Graph> >()> > generator,
 	    bool onlyUniverse, IsomorphismPolicy graphPolicy);
+	Add(const std::vector<std::shared_ptr<graph::LazyGraph> > lazyGraphs,
+	    const std::vector<std::shared_ptr<rule::Rule> > rules,
+	    bool onlyUniverse, IsomorphismPolicy graphPolicy);
 	virtual ~Add() override;
 	virtual Strategy *clone() const override;
 	virtual void preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const override;
 	virtual void forEachRule(std::function<void(const lib::Rules::Real &)> f) const override {}
 	virtual void printInfo(PrintSettings settings) const override;
+	virtual const char *getKind() const override { return "Add"; }
 	virtual bool isConsumed(const lib::Graph::Single *g) const override;
 private:
 	virtual void executeImpl(PrintSettings settings, const GraphState &input) override;
 private:
 	const std::vector<std::shared_ptr<graph::Graph> > graphs;
 	const std::shared_ptr<mod::Function<std::vector<std::shared_ptr<graph::Graph> >()> > generator;
+	// the lazy graphs are only loaded if they may match one of the rules, or always if no rules are given
+	const std::vector<std::shared_ptr<graph::LazyGraph> > lazyGraphs;
+	const std::vector<std::shared_ptr<rule::Rule> > rules;
+	const bool isLazy = false;
 	const bool onlyUniverse;
 	const IsomorphismPolicy graphPolicy;
 };
@@ -50,6 +50,12 @@ bool DerivationPredicate::isConsumed(const lib::Graph::Single *g) const {
 	return strat->isConsumed(g);
 }
 
+void DerivationPredicate::continueFrom(Strategy &prevRound) {
+	auto *prev = dynamic_cast<DerivationPredicate *>(&prevRound);
+	if(!prev) return;
+	strat->continueFrom(*prev->strat);
+}
+
 void DerivationPredicate::setExecutionEnvImpl() {
 	strat->setExecutionEnv(getExecutionEnv());
 }
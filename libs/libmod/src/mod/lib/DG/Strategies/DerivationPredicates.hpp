@@ -19,6 +19,7 @@ public:
 	virtual void printInfo(PrintSettings settings) const override;
 	virtual const GraphState &getOutput() const override;
 	virtual bool isConsumed(const lib::Graph::Single *g) const override;
+	virtual void continueFrom(Strategy &prevRound) override;
 protected:
 	virtual void printName(std::ostream &s) const = 0;
 	virtual void pushPredicate(std::shared_ptr<mod::Function<bool(const mod::Derivation&)> > pred) = 0;
@@ -34,6 +35,7 @@ protected:
 struct LeftPredicate : DerivationPredicate {
 	LeftPredicate(std::shared_ptr<mod::Function<bool(const mod::Derivation&)> > predicate, Strategy *strat);
 	Strategy *clone() const;
+	const char *getKind() const override { return "LeftPredicate"; }
 private:
 	void printName(std::ostream &s) const;
 	void pushPredicate(std::shared_ptr<mod::Function<bool(const mod::Derivation&)> > pred);
@@ -43,6 +45,7 @@ private:
 struct RightPredicate : DerivationPredicate {
 	RightPredicate(std::shared_ptr<mod::Function<bool(const mod::Derivation&)> > predicate, Strategy *strat);
 	Strategy *clone() const;
+	const char *getKind() const override { return "RightPredicate"; }
 private:
 	void printName(std::ostream &s) const;
 	void pushPredicate(std::shared_ptr<mod::Function<bool(const mod::Derivation&)> > pred);
@@ -1,10 +1,13 @@
 #include "Filter.hpp"
 
 #include <mod/Config.hpp>
+#include <mod/Error.hpp>
 #include <mod/Function.hpp>
 #include <mod/lib/DG/Strategies/GraphState.hpp>
 #include <mod/lib/Graph/Single.hpp>
 
+#include <string>
+
 namespace mod {
 namespace lib {
 namespace DG {
@@ -16,8 +19,16 @@ Filter::Filter(std::shared_ptr<mod::Function<bool(std::shared_ptr<graph::Graph>,
 	assert(filterFunc);
 }
 
+Filter::Filter(std::shared_ptr<mod::Function<std::vector<bool>(const std::vector<std::shared_ptr<graph::Graph> > &,
+                                                               const dg::Strategy::GraphState &)>> filterBatchFunc,
+               bool filterUniverse)
+		: Strategy(1), filterBatchFunc(filterBatchFunc), filterUniverse(filterUniverse) {
+	assert(filterBatchFunc);
+}
+
 Strategy *Filter::clone() const {
-	return new Filter(filterFunc->clone(), filterUniverse);
+	if(filterFunc) return new Filter(filterFunc->clone(), filterUniverse);
+	else return new Filter(filterBatchFunc->clone(), filterUniverse);
 }
 
 void Filter::preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const {}
@@ -30,7 +41,7 @@ void Filter::printInfo(PrintSettings settings) const {
 	s << '\n';
 	++settings.indentLevel;
 	settings.indent() << "predicate = ";
-	filterFunc->print(s);
+	printPredicate(s);
 	s << '\n';
 	printBaseInfo(settings);
 	--settings.indentLevel;
@@ -47,7 +58,7 @@ void Filter::executeImpl(PrintSettings settings, const GraphState &input) {
 		else
 			settings.indent() << "FilterSubset: ";
 		if(settings.verbosity >= PrintSettings::V_FilterPred)
-			filterFunc->print(settings.s);
+			printPredicate(settings.s);
 		settings.s << std::endl;
 		++settings.indentLevel;
 	}
@@ -65,29 +76,27 @@ void Filter::executeImpl(PrintSettings settings, const GraphState &input) {
 		assert(input.hasSubset(0));
 		unsigned int subsetIndex = 0;
 
-		bool first = true;
+		const std::vector<bool> keep = evaluate(input.getSubset(subsetIndex), graphState);
+		std::size_t i = 0;
 		for(const lib::Graph::Single *g : input.getSubset(subsetIndex)) {
 			// TODO: the adding to the subset could be faster as the index is the same as in the input ResultSet
-			if((*filterFunc)(g->getAPIReference(), graphState, first)) {
+			if(keep[i]) {
 				assert(output->isInUniverse(g));
 				output->addToSubset(subsetIndex, g);
 			}
-			first = false;
+			++i;
 		}
 		// TODO: add the complete other subsets
 		assert(input.getSubsets().size() == 1); // TODO: fix when filter is parameterized by subset
 		assert(input.hasSubset(0));
 	} else {
+		const std::vector<bool> keep = evaluate(input.getUniverse(), graphState);
 		std::map<const lib::Graph::Single *, bool> copyToOutput;
-		bool first = true;
-		for(const lib::Graph::Single *g : input.getUniverse()) {
-			copyToOutput[g] = (*filterFunc)(g->getAPIReference(), graphState, first);
-			first = false;
-		}
 		std::vector<const lib::Graph::Single *> newUniverse;
-
-		for(const lib::Graph::Single *g : input.getUniverse()) {
-			if(copyToOutput[g]) newUniverse.push_back(g);
+		for(std::size_t i = 0; i != input.getUniverse().size(); ++i) {
+			const lib::Graph::Single *g = input.getUniverse()[i];
+			copyToOutput[g] = keep[i];
+			if(keep[i]) newUniverse.push_back(g);
 		}
 		output = new GraphState(newUniverse);
 
@@ -103,6 +112,34 @@ void Filter::executeImpl(PrintSettings settings, const GraphState &input) {
 	}
 }
 
+void Filter::printPredicate(std::ostream &s) const {
+	if(filterFunc) filterFunc->print(s);
+	else {
+		s << "batch ";
+		filterBatchFunc->print(s);
+	}
+}
+
+template<typename Graphs>
+std::vector<bool> Filter::evaluate(const Graphs &graphs, const dg::Strategy::GraphState &graphState) const {
+	std::vector<bool> keep;
+	if(filterFunc) {
+		keep.reserve(graphs.size());
+		bool first = true;
+		for(const lib::Graph::Single *g : graphs) {
+			keep.push_back((*filterFunc)(g->getAPIReference(), graphState, first));
+			first = false;
+		}
+	} else {
+		const auto &apiGraphs = filterUniverse ? graphState.getUniverse() : graphState.getSubset();
+		keep = (*filterBatchFunc)(apiGraphs, graphState);
+		if(keep.size() != graphs.size())
+			throw LogicError("The batch filter predicate returned " + std::to_string(keep.size())
+			                 + " values for " + std::to_string(graphs.size()) + " graphs.");
+	}
+	return keep;
+}
+
 } // namespace Strategies
 } // namespace DG
 } // namespace lib
@@ -12,16 +12,28 @@ namespace Strategies {
 struct Filter : Strategy {
 	Filter(std::shared_ptr<mod::Function<bool(std::shared_ptr<graph::Graph>, const dg::Strategy::GraphState &,
 	                                          bool)>> filterFunc, bool filterUniverse);
+	// The predicate is called once with all the graphs to filter, and returns whether to keep each of them.
+	Filter(std::shared_ptr<mod::Function<std::vector<bool>(const std::vector<std::shared_ptr<graph::Graph> > &,
+	                                                       const dg::Strategy::GraphState &)>> filterBatchFunc,
+	       bool filterUniverse);
 	virtual Strategy *clone() const override;
 	virtual void preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const override;
 	virtual void forEachRule(std::function<void(const lib::Rules::Real &)> f) const override {}
 	virtual void printInfo(PrintSettings settings) const override;
+	virtual const char *getKind() const override { return "Filter"; }
 	virtual bool isConsumed(const lib::Graph::Single *g) const override;
 private:
 	virtual void executeImpl(PrintSettings settings, const GraphState &input) override;
+	void printPredicate(std::ostream &s) const;
+	// graphs must be the subset or universe being filtered, in the same order as in graphState
+	template<typename Graphs>
+	std::vector<bool> evaluate(const Graphs &graphs, const dg::Strategy::GraphState &graphState) const;
 private:
+	// exactly one of them is set
 	std::shared_ptr<mod::Function<bool(std::shared_ptr<graph::Graph>, const dg::Strategy::GraphState &,
 	                                   bool)> > filterFunc;
+	std::shared_ptr<mod::Function<std::vector<bool>(const std::vector<std::shared_ptr<graph::Graph> > &,
+	                                                const dg::Strategy::GraphState &)> > filterBatchFunc;
 	bool filterUniverse;
 };
 
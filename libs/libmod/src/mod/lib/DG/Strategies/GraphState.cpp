@@ -3,10 +3,21 @@
 #include <mod/lib/Graph/Single.hpp>
 #include <mod/lib/IO/IO.hpp>
 
+#include <map>
+#include <set>
+
 namespace mod {
 namespace lib {
 namespace DG {
 namespace Strategies {
+namespace {
+
+std::size_t getFingerprint(const Graph::Single *g) {
+	// spread the bits, as the fingerprints are summed
+	return std::hash<const Graph::Single *>()(g) * std::size_t(0x9E3779B97F4A7C15ull);
+}
+
+} // namespace
 
 void GraphState::commonInit() {
 	// subset 0 is special
@@ -19,7 +30,8 @@ GraphState::GraphState() {
 	commonInit();
 }
 
-GraphState::GraphState(const GraphState &other) : universe(other.universe) {
+GraphState::GraphState(const GraphState &other)
+		: universe(other.universe), universeFingerprint(other.universeFingerprint) {
 	assert(other.subsets.size() >= 1);
 	assert(other.subsets.begin()->first == 0);
 	// commonInit is not needed, as other should have subset 0
@@ -32,6 +44,7 @@ GraphState::GraphState(const GraphState &other) : universe(other.universe) {
 
 GraphState::GraphState(const std::vector<const Graph::Single*> &universe) : universe(universe) {
 	commonInit();
+	for(const Graph::Single *g : universe) universeFingerprint += getFingerprint(g);
 }
 
 GraphState::GraphState(const std::vector<const GraphState*> &resultSets) {
@@ -54,6 +67,7 @@ GraphState::GraphState(const std::vector<const GraphState*> &resultSets) {
 		std::set_union(universe.begin(), universe.end(), other.begin(), other.end(), std::back_inserter(result), lib::Graph::Single::IdLess());
 		std::swap(result, universe);
 	}
+	for(const Graph::Single *g : universe) universeFingerprint += getFingerprint(g);
 	// collect all subsets
 	using NewSubsetStore = std::map<unsigned int, std::set<const Graph::Single*, lib::Graph::Single::IdLess> >;
 	NewSubsetStore newSubsets;
@@ -75,7 +89,10 @@ GraphState::GraphState(const std::vector<const GraphState*> &resultSets) {
 		std::pair < SubsetStore::iterator, bool> p = subsets.insert(std::make_pair(newSubset.first, Subset(*this)));
 		assert(p.second);
 		Subset &subset = p.first->second;
-		for(const Graph::Single *g : newSubset.second) subset.indices.push_back(graphToIndex[g]);
+		for(const Graph::Single *g : newSubset.second) {
+			subset.indices.push_back(graphToIndex[g]);
+			subset.fingerprint += getFingerprint(g);
+		}
 	}
 
 	assert(subsets.size() >= 1);
@@ -110,6 +127,7 @@ void GraphState::addToSubset(unsigned int subsetIndex, const lib::Graph::Single
 		if(index == gIndex) return;
 	}
 	subset.indices.push_back(gIndex);
+	subset.fingerprint += getFingerprint(g);
 }
 
 void GraphState::addToUniverse(const Graph::Single *g) {
@@ -155,8 +173,11 @@ bool operator==(const GraphState &a, const GraphState &b) {
 				ai != ae && bi != be; ai++, bi++) {
 			if(ai->first != bi->first) return false;
 			if(ai->second.size() != bi->second.size()) return false;
+			if(ai->second.fingerprint != bi->second.fingerprint) return false;
 		}
+		if(a.universeFingerprint != b.universeFingerprint) return false;
 	}
+	// most likely equal, so confirm it
 	GraphState aCopy(a), bCopy(b);
 	std::less<const Graph::Single*> comp;
 	aCopy.sortUniverse(comp);
@@ -182,6 +203,7 @@ unsigned int GraphState::addUniverseGetIndex(const lib::Graph::Single *g) {
 		if(universe[i] == g) return i;
 	}
 	universe.push_back(g);
+	universeFingerprint += getFingerprint(g);
 	return universe.size() - 1;
 }
 
@@ -33,7 +33,8 @@ struct GraphState {
 		using size_type = std::vector<unsigned int>::size_type;
 	public:
 		explicit Subset(const GraphState &rs) : rs(rs) {}
-		explicit Subset(const GraphState &rs, const Subset &other) : rs(rs), indices(other.indices) {}
+		explicit Subset(const GraphState &rs, const Subset &other)
+				: rs(rs), indices(other.indices), fingerprint(other.fingerprint) {}
 
 		const_iterator begin() const {
 			return const_iterator(indices.begin(), Transformer(rs.getUniverse()));
@@ -52,8 +53,10 @@ struct GraphState {
 		}
 	private:
 		friend class GraphState;
+		friend bool operator==(const GraphState &a, const GraphState &b);
 		const GraphState &rs;
 		std::vector<unsigned int> indices;
+		std::size_t fingerprint = 0; // see GraphState::universeFingerprint
 	};
 	using SubsetStore = std::unordered_map<unsigned int, Subset>;
 private:
@@ -86,6 +89,9 @@ private:
 private:
 	GraphList universe;
 	SubsetStore subsets;
+	// An order independent hash of the graphs, maintained on insertion,
+	// such that most unequal states can be detected in constant time.
+	std::size_t universeFingerprint = 0;
 };
 
 template<typename T>
@@ -2,8 +2,10 @@
 
 #include <mod/Config.hpp>
 #include <mod/lib/DG/Strategies/GraphState.hpp>
+#include <mod/lib/DG/Strategies/Rule.hpp>
 #include <mod/lib/Graph/Single.hpp>
 #include <mod/lib/IO/IO.hpp>
+#include <mod/lib/ThreadPool.hpp>
 
 namespace mod {
 namespace lib {
@@ -66,6 +68,13 @@ bool Parallel::isConsumed(const Graph::Single *g) const {
 	return false;
 }
 
+void Parallel::continueFrom(Strategy &prevRound) {
+	auto *prev = dynamic_cast<Parallel *>(&prevRound);
+	if(!prev || prev->strats.size() != strats.size()) return;
+	for(std::size_t i = 0; i != strats.size(); ++i)
+		strats[i]->continueFrom(*prev->strats[i]);
+}
+
 void Parallel::setExecutionEnvImpl() {
 	for(Strategy *strat : strats) strat->setExecutionEnv(getExecutionEnv());
 }
@@ -75,6 +84,7 @@ void Parallel::executeImpl(PrintSettings settings, const GraphState &input) {
 		settings.indent() << "Parallel: " << strats.size() << " substrategies" << std::endl;
 		++settings.indentLevel;
 	}
+	precomputeRules(settings, input);
 	for(unsigned int i = 0; i != strats.size(); i++) {
 		Strategy *strat = strats[i];
 		if(settings.verbosity >= PrintSettings::V_Parallel) {
@@ -94,6 +104,40 @@ void Parallel::executeImpl(PrintSettings settings, const GraphState &input) {
 		output->sortSubset(vt.first, Graph::Single::nameLess);
 }
 
+bool Parallel::collectRules(std::vector<Rule *> &rules) const {
+	for(Strategy *strat : strats) {
+		if(auto *r = dynamic_cast<Rule *>(strat)) {
+			rules.push_back(r);
+		} else if(const auto *p = dynamic_cast<const Parallel *>(strat)) {
+			if(!p->collectRules(rules)) return false;
+		} else {
+			return false;
+		}
+	}
+	return true;
+}
+
+void Parallel::precomputeRules(PrintSettings settings, const GraphState &input) {
+	if(getConfig().common.numThreads.get() <= 1) return;
+	if(lib::isInParallelTask()) return;
+	const auto labelSettings = getExecutionEnv().labelSettings;
+	if(!Rule::canPrecompute(settings, getExecutionEnv())) return;
+	std::vector<Rule *> rules;
+	if(!collectRules(rules)) return;
+	if(rules.size() <= 1) return;
+	// e.g., when nested in a parallel strategy which already did it
+	if(rules.front()->hasPrecomputed(input)) return;
+	try {
+		Rule::prepareForPrecompute(rules, input, labelSettings);
+		lib::parallelForEach(rules.size(), [&](std::size_t i) {
+			rules[i]->precompute(settings, input);
+		});
+	} catch(...) {
+		// let the serial execution report the error at the right point
+		for(Rule *r : rules) r->discardPrecomputed();
+	}
+}
+
 } // namespace Strategies
 } // namespace DG
 } // namespace lib
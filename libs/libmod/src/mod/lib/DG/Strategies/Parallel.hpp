@@ -9,6 +9,7 @@ namespace mod {
 namespace lib {
 namespace DG {
 namespace Strategies {
+struct Rule;
 
 struct Parallel : Strategy {
 	Parallel(const std::vector<Strategy*> &strats);
@@ -17,10 +18,17 @@ struct Parallel : Strategy {
 	virtual void preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const override;
 	virtual void forEachRule(std::function<void(const lib::Rules::Real&)> f) const override;
 	virtual void printInfo(PrintSettings settings) const override;
+	virtual const char *getKind() const override { return "Parallel"; }
 	virtual bool isConsumed(const lib::Graph::Single *g) const override;
+	virtual void continueFrom(Strategy &prevRound) override;
 private:
 	virtual void setExecutionEnvImpl() override;
 	virtual void executeImpl(PrintSettings settings, const GraphState &input) override;
+	// Collects the substrategies, if they all are rule strategies, possibly nested in parallel strategies.
+	bool collectRules(std::vector<Rule*> &rules) const;
+	// Lets the rule substrategies find their derivations concurrently,
+	// such that the following serial execution of the substrategies only has to add them to the DG.
+	void precomputeRules(PrintSettings settings, const GraphState &input);
 private:
 	std::vector<Strategy*> strats;
 };
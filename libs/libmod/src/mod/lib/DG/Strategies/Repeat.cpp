@@ -69,6 +69,8 @@ void Repeat::executeImpl(PrintSettings settings, const GraphState &input) {
 	for(int i = 0; i != limit; ++i) {
 		Strategy *subStrat = strat->clone();
 		subStrat->setExecutionEnv(getExecutionEnv());
+		if(i != 0 && getConfig().dg.semiNaiveRepeat.get() && getConfig().dg.ignoreSubset.get())
+			subStrat->continueFrom(*subStrats[i - 1]);
 		if(settings.verbosity >= PrintSettings::V_Repeat)
 			settings.indent() << "Round " << (i + 1) << ":" << std::endl;
 		++settings.indentLevel;
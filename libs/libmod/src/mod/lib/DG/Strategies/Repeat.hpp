@@ -15,6 +15,7 @@ struct Repeat : Strategy {
 	virtual void preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const override;
 	virtual void forEachRule(std::function<void(const lib::Rules::Real &)> f) const override;
 	virtual void printInfo(PrintSettings settings) const override;
+	virtual const char *getKind() const override { return "Repeat"; }
 	virtual const GraphState &getOutput() const override;
 	virtual bool isConsumed(const lib::Graph::Single *g) const override;
 private:
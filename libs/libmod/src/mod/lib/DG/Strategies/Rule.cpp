@@ -4,11 +4,20 @@
 #include <mod/Derivation.hpp>
 #include <mod/Misc.hpp>
 #include <mod/rule/Rule.hpp>
+#include <mod/lib/Arena.hpp>
+#include <mod/lib/DG/CompositionCache.hpp>
+#include <mod/lib/DG/DirectRuleApplication.hpp>
 #include <mod/lib/DG/RuleApplicationUtils.hpp>
 #include <mod/lib/DG/Strategies/GraphState.hpp>
 #include <mod/lib/IO/IO.hpp>
 #include <mod/lib/RC/ComposeRuleReal.hpp>
+#include <mod/lib/RC/MatchMaker/HostSymmetry.hpp>
 #include <mod/lib/RC/MatchMaker/Super.hpp>
+#include <mod/lib/Stopwatch.hpp>
+#include <mod/lib/ThreadPool.hpp>
+
+#include <mutex>
+#include <thread>
 
 namespace mod {
 namespace lib {
@@ -26,6 +35,16 @@ Rule::Rule(const lib::Rules::Real *r)
 	assert(r->getDPORule().numLeftComponents > 0);
 }
 
+struct Rule::Precomputed {
+	const GraphState *input;
+	// the complete results, in the order they would have been found by execute
+	std::vector<BoundRule> results;
+};
+
+Rule::~Rule() {
+	discardPrecomputed();
+}
+
 Strategy *Rule::clone() const {
 	if(r) return new Rule(r);
 	else return new Rule(rRaw);
@@ -53,49 +72,96 @@ bool Rule::isConsumed(const lib::Graph::Single *g) const {
 	return consumedGraphs.find(g) != consumedGraphs.end();
 }
 
+void Rule::continueFrom(Strategy &prevRound) {
+	auto *prev = dynamic_cast<Rule *>(&prevRound);
+	if(!prev || prev->rRaw != rRaw) return;
+	triedBefore = std::move(prev->triedAfter);
+}
+
 namespace {
 
+// The arenas for the intermediary rules made in a round of bindComponents, one for each composing thread.
+struct RuleArenas {
+	explicit RuleArenas(bool enabled) : enabled(enabled) {}
+
+	RuleArenas(const RuleArenas &) = delete;
+	RuleArenas &operator=(const RuleArenas &) = delete;
+
+	~RuleArenas() {
+		static std::mutex counterMtx;
+		std::lock_guard<std::mutex> lock(counterMtx);
+		for(const auto &p : arenas) {
+			getConfig().dg.numRuleArenaAllocations.increment(p.second->getNumAllocations());
+			getConfig().dg.numRuleArenaBlocks.increment(p.second->getNumBlocks());
+		}
+	}
+
+	// Returns null if arenas are not used, i.e., the rules should be allocated on the heap.
+	lib::Arena *getForThisThread() {
+		if(!enabled) return nullptr;
+		const auto id = std::this_thread::get_id();
+		std::lock_guard<std::mutex> lock(mtx);
+		for(const auto &p : arenas)
+			if(p.first == id) return p.second.get();
+		arenas.emplace_back(id, std::make_unique<lib::Arena>());
+		return arenas.back().second.get();
+	}
+
+	// pre: all rules allocated from the arenas have been deleted, and no thread is composing
+	void release() {
+		for(const auto &p : arenas) p.second->release();
+	}
+private:
+	const bool enabled;
+	std::mutex mtx;
+	std::vector<std::pair<std::thread::id, std::unique_ptr<lib::Arena> > > arenas;
+};
+
 struct Context {
 	const std::shared_ptr<rule::Rule> &r;
 	ExecutionEnv &executionEnv;
 	GraphState *output;
 	std::unordered_set<const lib::Graph::Single *> &consumedGraphs;
+	// if not null, complete results are stored here instead of being turned into derivations
+	std::vector<BoundRule> *deferred;
+	// if not null, bindings using only graphs from this set are skipped
+	const std::unordered_set<const lib::Graph::Single *> *tried;
+	// if not null, partial results which are duplicates of previous partial results are discarded
+	BoundRuleIndex *intermediaries;
+	dg::ExecuteStatistics::RuleStatistics &statistics;
+	// if not null, new intermediary rules are allocated from these arenas
+	RuleArenas *arenas = nullptr;
+	// if true, processBoundRules deletes all the new rules, so the arenas can be released afterwards
+	bool releaseArenas = false;
 };
 
-void handleBoundRulePair(PrintSettings settings, Context context, const BoundRule &brp) {
-	assert(brp.rule);
-	// use a smart pointer so the rule for sure is deallocated, even though we do a 'continue'
-	const lib::Rules::Real &r = *brp.rule;
-	const auto &rDPO = r.getDPORule();
-	assert(
-			r.isOnlyRightSide()); // otherwise, it should have been deallocated. All max component results should be only right side
+bool isTriedBefore(Context context, const lib::Graph::Single *g, const BoundRule &p) {
+	if(!context.tried) return false;
+	const auto &tried = *context.tried;
+	if(tried.find(g) == tried.end()) return false;
+	for(const lib::Graph::Single *gBound : p.boundGraphs)
+		if(tried.find(gBound) == tried.end()) return false;
+	return true;
+}
+
+// Turns a candidate derivation into a derivation, if the derivation predicates accept it.
+// The products are only made, by makeProducts, after the left predicate has accepted the educts.
+template<typename MakeProducts>
+void handleDerivation(PrintSettings settings, Context context, const std::string &name,
+                      const std::vector<const lib::Graph::Single *> &educts, MakeProducts makeProducts) {
 	mod::Derivation d;
 	d.r = context.r;
-	for(const lib::Graph::Single *g : brp.boundGraphs) d.left.push_back(g->getAPIReference());
+	for(const lib::Graph::Single *g : educts) d.left.push_back(g->getAPIReference());
 	{ // left predicate
 		bool result = context.executionEnv.checkLeftPredicate(d);
 		if(!result) {
+			++context.statistics.leftPredicateRejections;
 			if(settings.verbosity >= PrintSettings::V_DerivationPredicatesFail)
-				settings.indent() << "Skipping " << r.getName() << " due to leftPredicate" << std::endl;
+				settings.indent() << "Skipping " << name << " due to leftPredicate" << std::endl;
 			return;
 		}
 	}
-	if(settings.verbosity >= PrintSettings::V_RuleApplication)
-		settings.indent() << "Splitting " << r.getName() << " into "
-								<< rDPO.numRightComponents << " graphs:" << std::endl;
-	const std::vector<const lib::Graph::Single *> &educts = brp.boundGraphs;
-	d.right = splitRule(
-			rDPO, context.executionEnv.labelSettings.type, context.executionEnv.labelSettings.withStereo,
-			[&context](std::unique_ptr<lib::Graph::Single> gCand) {
-				return context.executionEnv.checkIfNew(std::move(gCand));
-			},
-			[&settings](std::shared_ptr<graph::Graph> gWrapped, std::shared_ptr<graph::Graph> gPrev) {
-				if(settings.verbosity >= PrintSettings::V_RuleApplication)
-					settings.indent() << "Discarding product " << gWrapped->getName()
-											<< ", isomorphic to other product " << gPrev->getName()
-											<< "." << std::endl;
-			}
-	);
+	d.right = makeProducts();
 
 	if(getConfig().dg.onlyProduceMolecules.get()) {
 		for(std::shared_ptr<graph::Graph> g : d.right) {
@@ -116,8 +182,9 @@ void handleBoundRulePair(PrintSettings settings, Context context, const BoundRul
 	{ // right predicates
 		bool result = context.executionEnv.checkRightPredicate(d);
 		if(!result) {
+			++context.statistics.rightPredicateRejections;
 			if(settings.verbosity >= PrintSettings::V_DerivationPredicatesFail)
-				settings.indent() << "Skipping " << r.getName() << " due to rightPredicate" << std::endl;
+				settings.indent() << "Skipping " << name << " due to rightPredicate" << std::endl;
 			return;
 		}
 	}
@@ -133,7 +200,8 @@ void handleBoundRulePair(PrintSettings settings, Context context, const BoundRul
 		}
 		for(unsigned int i = 0; i < d.right.size(); i++) {
 			auto g = d.right[i];
-			context.executionEnv.addProduct(g);
+			if(context.executionEnv.addProduct(g)) ++context.statistics.productsNew;
+			else ++context.statistics.productsDuplicate;
 		}
 	}
 	std::vector<const lib::Graph::Single *> rightGraphs;
@@ -148,46 +216,167 @@ void handleBoundRulePair(PrintSettings settings, Context context, const BoundRul
 	}
 }
 
+auto makeCheckIfNew(Context context) {
+	return [context](std::unique_ptr<lib::Graph::Single> gCand) {
+		return context.executionEnv.checkIfNew(std::move(gCand));
+	};
+}
+
+auto makeOnDuplicateProduct(PrintSettings settings) {
+	return [settings](std::shared_ptr<graph::Graph> gWrapped, std::shared_ptr<graph::Graph> gPrev) {
+		if(settings.verbosity >= PrintSettings::V_RuleApplication)
+			settings.indent() << "Discarding product " << gWrapped->getName()
+									<< ", isomorphic to other product " << gPrev->getName()
+									<< "." << std::endl;
+	};
+}
+
+void handleBoundRulePair(PrintSettings settings, Context context, const BoundRule &brp) {
+	assert(brp.rule);
+	const lib::Rules::Real &r = *brp.rule;
+	const auto &rDPO = r.getDPORule();
+	assert(
+			r.isOnlyRightSide()); // otherwise, it should have been deallocated. All max component results should be only right side
+	handleDerivation(settings, context, r.getName(), brp.boundGraphs, [&]() {
+		if(settings.verbosity >= PrintSettings::V_RuleApplication)
+			settings.indent() << "Splitting " << r.getName() << " into "
+									<< rDPO.numRightComponents << " graphs:" << std::endl;
+		return splitRule(rDPO, context.executionEnv.labelSettings.type, context.executionEnv.labelSettings.withStereo,
+		                 makeCheckIfNew(context), makeOnDuplicateProduct(settings));
+	});
+}
+
+bool usePruneSymmetricMatches(const lib::Graph::Single &g, LabelSettings labelSettings) {
+	return getConfig().dg.pruneSymmetricMatches.get() && lib::RC::canUseHostSymmetry(g, labelSettings);
+}
+
+void prepareForBinding(const lib::Graph::Single &g, LabelSettings labelSettings) {
+	lib::RC::prepareForComposition(g.getBindRule()->getRule(), labelSettings);
+	if(usePruneSymmetricMatches(g, labelSettings))
+		lib::RC::prepareHostSymmetry(g, labelSettings);
+}
+
+// Binds g to the intermediary rule p, i.e., composes the bind rule of g with p.
+// The resulting intermediary rules are returned, with duplicates removed.
+// Only the result objects are modified, so calls for different (g, p) pairs may run concurrently.
+// With a cache, the results for a p not owned by the binding are looked up first,
+// and otherwise computed and inserted, such that the results are owned by the cache.
+// Otherwise the results are allocated from the given arena, if not null.
+// The number of matches skipped due to symmetries of g is added to numPruned.
+std::vector<BoundRule> composeBoundRule(PrintSettings settings, LabelSettings labelSettings, CompositionCache *cache,
+                                        lib::Arena *arena, const lib::Graph::Single *g, const BoundRule &p,
+                                        std::size_t &numPruned) {
+	std::vector<BoundRule> resultRules;
+	BoundRuleStorage ruleStore(settings.verbosity >= PrintSettings::V_RuleApplication,
+										settings,
+										labelSettings.type,
+										labelSettings.withStereo, resultRules, p, g);
+	assert(p.rule);
+	const lib::Rules::Real &rFirst = g->getBindRule()->getRule();
+	const lib::Rules::Real &rSecond = *p.rule;
+	const auto compose = [&](auto reporter) {
+		boost::optional<lib::RC::HostSymmetry> symmetry;
+		if(usePruneSymmetricMatches(*g, labelSettings))
+			symmetry = lib::RC::makeHostSymmetry(*g, labelSettings);
+		lib::RC::Super mm(
+				std::max(0, settings.verbosity - PrintSettings::V_RCMorphismGenBase),
+				settings,
+				true, true, symmetry ? &*symmetry : nullptr);
+		lib::RC::composeRuleRealByMatchMaker(rFirst, rSecond, mm, reporter, labelSettings);
+		if(symmetry) numPruned += symmetry->getNumPruned();
+	};
+	if(cache && !p.owned) {
+		const CompositionCache::Results *cached = cache->find(rSecond, *g);
+		if(!cached) {
+			CompositionCache::Results results;
+			compose([&results, labelSettings](std::unique_ptr<lib::Rules::Real> r) {
+				// other threads may use the result as soon as it is in the cache
+				lib::RC::prepareForComposition(*r, labelSettings);
+				results.push_back(std::move(r));
+				return true;
+			});
+			cached = &cache->insert(rSecond, *g, std::move(results));
+		} else if(settings.verbosity >= PrintSettings::V_RuleApplication) {
+			settings.indent() << "Using " << cached->size() << " cached results" << std::endl;
+		}
+		for(const auto &r : *cached)
+			ruleStore.add(r.get(), false);
+	} else {
+		const lib::ArenaScope scope(arena);
+		compose([&ruleStore](std::unique_ptr<lib::Rules::Real> r) {
+			ruleStore.add(r.release());
+			return true;
+		});
+	}
+	return resultRules;
+}
+
+void deleteBoundRule(const BoundRule &brp) {
+	if(brp.owned) delete brp.rule;
+}
+
+// Complete results are turned into derivations, while partial results are passed on in outputRules.
+void processBoundRules(PrintSettings settings, Context context,
+                       const std::vector<BoundRule> &resultRules,
+                       std::vector<BoundRule> &outputRules,
+                       unsigned int &processedRules) {
+	for(const BoundRule &brp : resultRules) {
+		processedRules++;
+		if(context.executionEnv.doExit()) deleteBoundRule(brp);
+		else if(brp.rule->isOnlyRightSide() && context.deferred) {
+			context.deferred->push_back(brp);
+		} else if(brp.rule->isOnlyRightSide()) {
+			++context.statistics.compositions;
+			++context.statistics.derivations;
+			handleBoundRulePair(settings, context, brp);
+			deleteBoundRule(brp);
+		} else if(context.intermediaries && !context.intermediaries->tryAdd(brp)) {
+			deleteBoundRule(brp);
+		} else {
+			++context.statistics.compositions;
+			outputRules.push_back(brp);
+		}
+	}
+}
+
+void deleteBoundRules(const std::vector<BoundRule> &rules) {
+	for(const BoundRule &brp : rules) deleteBoundRule(brp);
+}
+
+bool canBindInParallel(PrintSettings settings, Context context) {
+	if(getConfig().common.numThreads.get() <= 1) return false;
+	// e.g., from a precompute
+	if(lib::isInParallelTask()) return false;
+	// per-binding output would be interleaved
+	if(settings.verbosity >= PrintSettings::V_RuleApplication) return false;
+	if(getConfig().rc.printMatches.get()) return false;
+	return true;
+}
+
 template<typename GraphRange>
-unsigned int bindGraphs(PrintSettings settings, Context context,
-								const GraphRange &graphRange,
-								const std::vector<BoundRule> &rules,
-								std::vector<BoundRule> &outputRules) {
+unsigned int bindGraphsSerial(PrintSettings settings, Context context,
+										const GraphRange &graphRange,
+										const std::vector<BoundRule> &rules,
+										std::vector<BoundRule> &outputRules) {
 	unsigned int processedRules = 0;
-
+	lib::Arena *arena = context.arenas ? context.arenas->getForThisThread() : nullptr;
 	for(const lib::Graph::Single *g : graphRange) {
 		if(context.executionEnv.doExit()) break;
 		for(const BoundRule &p : rules) {
 			if(context.executionEnv.doExit()) break;
+			if(isTriedBefore(context, g, p)) continue;
 			if(settings.verbosity >= PrintSettings::V_RuleApplication) {
 				settings.indent() << "Trying to bind " << g->getName() << " to " << p.rule->getName() << ":" << std::endl;
 				++settings.indentLevel;
 			}
-			std::vector<BoundRule> resultRules;
-			BoundRuleStorage ruleStore(settings.verbosity >= PrintSettings::V_RuleApplication,
-												settings,
-												context.executionEnv.labelSettings.type,
-												context.executionEnv.labelSettings.withStereo, resultRules, p, g);
-			auto reporter = [&ruleStore](std::unique_ptr<lib::Rules::Real> r) {
-				ruleStore.add(r.release());
-				return true;
-			};
-			assert(p.rule);
-			const lib::Rules::Real &rFirst = g->getBindRule()->getRule();
-			const lib::Rules::Real &rSecond = *p.rule;
-			lib::RC::Super mm(
-					std::max(0, settings.verbosity - PrintSettings::V_RCMorphismGenBase),
-					settings,
-					true, true);
-			lib::RC::composeRuleRealByMatchMaker(rFirst, rSecond, mm, reporter, context.executionEnv.labelSettings);
-			for(const BoundRule &brp : resultRules) {
-				processedRules++;
-				if(context.executionEnv.doExit()) delete brp.rule;
-				else if(brp.rule->isOnlyRightSide()) {
-					handleBoundRulePair(settings, context, brp);
-					delete brp.rule;
-				} else outputRules.push_back(brp);
-			}
+			const Stopwatch stopwatch;
+			const auto resultRules = composeBoundRule(settings, context.executionEnv.labelSettings,
+			                                          context.executionEnv.getCompositionCache(), arena, g, p,
+			                                          context.statistics.symmetricMatchesPruned);
+			++context.statistics.bindingsTried;
+			context.statistics.bindingTime += stopwatch.seconds();
+			processBoundRules(settings, context, resultRules, outputRules, processedRules);
+			if(context.releaseArenas) context.arenas->release();
 			if(settings.verbosity >= PrintSettings::V_RuleApplication)
 				--settings.indentLevel;
 		}
@@ -195,49 +384,110 @@ unsigned int bindGraphs(PrintSettings settings, Context context,
 	return processedRules;
 }
 
-} // namespace 
-
-void Rule::executeImpl(PrintSettings settings, const GraphState &input) {
-	if(settings.verbosity >= PrintSettings::V_Rule) {
-		settings.indent() << "Rule: " << r->getName() << std::endl;
-		++settings.indentLevel;
-	}
+// The compositions are distributed over the thread pool in chunks of (graph, rule) pairs.
+// Each chunk is afterwards processed serially in the same order as in bindGraphsSerial,
+// so the products, derivations, and intermediary rules come out exactly as in the serial version.
+template<typename GraphRange>
+unsigned int bindGraphsParallel(PrintSettings settings, Context context,
+										  const GraphRange &graphRange,
+										  const std::vector<BoundRule> &rules,
+										  std::vector<BoundRule> &outputRules) {
+	const auto labelSettings = context.executionEnv.labelSettings;
+	CompositionCache *cache = context.executionEnv.getCompositionCache();
+	const std::vector<const lib::Graph::Single *> graphs(graphRange.begin(), graphRange.end());
+	// warm the lazily computed data, so the threads do not wait for each other on the first accesses
+	lib::parallelForEach(graphs.size(), [&](std::size_t i) {
+		prepareForBinding(*graphs[i], labelSettings);
+	});
+	lib::parallelForEach(rules.size(), [&](std::size_t i) {
+		lib::RC::prepareForComposition(*rules[i].rule, labelSettings);
+	});
 
-	if(getExecutionEnv().labelSettings.withStereo) {
-		// let's trigger deduction errors early
-		try {
-			get_stereo(rRaw->getDPORule());
-		} catch(StereoDeductionError &e) {
-			std::stringstream ss;
-			ss << "\nStereo deduction error in rule '" << rRaw->getName() << "'.";
-			e.append(ss.str());
-			throw;
+	const std::size_t numPairs = graphs.size() * rules.size();
+	const std::size_t chunkSize = std::size_t(getConfig().common.numThreads.get()) * 16;
+	unsigned int processedRules = 0;
+	std::vector<std::vector<BoundRule> > results;
+	std::vector<std::exception_ptr> errors;
+	// negative if the binding was skipped
+	std::vector<double> times;
+	std::vector<std::size_t> numPruned;
+	for(std::size_t chunkBegin = 0; chunkBegin < numPairs; chunkBegin += chunkSize) {
+		if(context.executionEnv.doExit()) break;
+		const std::size_t chunkEnd = std::min(numPairs, chunkBegin + chunkSize);
+		results.clear();
+		results.resize(chunkEnd - chunkBegin);
+		errors.clear();
+		errors.resize(chunkEnd - chunkBegin);
+		times.assign(chunkEnd - chunkBegin, -1);
+		numPruned.assign(chunkEnd - chunkBegin, 0);
+		lib::parallelForEach(chunkEnd - chunkBegin, [&](std::size_t i) {
+			const std::size_t pairId = chunkBegin + i;
+			const lib::Graph::Single *g = graphs[pairId / rules.size()];
+			const BoundRule &p = rules[pairId % rules.size()];
+			if(isTriedBefore(context, g, p)) return;
+			try {
+				lib::Arena *arena = context.arenas ? context.arenas->getForThisThread() : nullptr;
+				const Stopwatch stopwatch;
+				results[i] = composeBoundRule(settings, labelSettings, cache, arena, g, p, numPruned[i]);
+				times[i] = stopwatch.seconds();
+			} catch(...) {
+				errors[i] = std::current_exception();
+			}
+		});
+		for(const double time : times) {
+			if(time < 0) continue;
+			++context.statistics.bindingsTried;
+			context.statistics.bindingTime += time;
 		}
-	}
-	if(getExecutionEnv().labelSettings.type == LabelType::Term) {
-		const auto &term = get_term(rRaw->getDPORule());
-		if(!isValid(term)) {
-			std::string msg = "Parsing failed for rule '" + rRaw->getName() + "'. " + term.getParsingError();
-			throw TermParsingError(std::move(msg));
+		for(const std::size_t n : numPruned)
+			context.statistics.symmetricMatchesPruned += n;
+		for(std::size_t i = 0; i != results.size(); ++i) {
+			if(errors[i] || context.executionEnv.doExit()) {
+				std::for_each(results.begin() + i, results.end(), deleteBoundRules);
+				if(errors[i]) std::rethrow_exception(errors[i]);
+				break;
+			}
+			try {
+				processBoundRules(settings, context, results[i], outputRules, processedRules);
+			} catch(...) {
+				std::for_each(results.begin() + i + 1, results.end(), deleteBoundRules);
+				throw;
+			}
 		}
+		if(context.releaseArenas) context.arenas->release();
 	}
+	return processedRules;
+}
 
-	output = new GraphState(input.getUniverse());
-	if(getExecutionEnv().doExit()) {
-		if(settings.verbosity >= PrintSettings::V_Rule)
-			settings.indent() << "Exit requrested, skipping." << std::endl;
-		return;
-	}
-	std::vector<std::vector<BoundRule> > intermediaryRules(rRaw->getDPORule().numLeftComponents + 1);
+template<typename GraphRange>
+unsigned int bindGraphs(PrintSettings settings, Context context,
+								const GraphRange &graphRange,
+								const std::vector<BoundRule> &rules,
+								std::vector<BoundRule> &outputRules) {
+	if(canBindInParallel(settings, context))
+		return bindGraphsParallel(settings, context, graphRange, rules, outputRules);
+	else
+		return bindGraphsSerial(settings, context, graphRange, rules, outputRules);
+}
+
+// Binds the graphs of the input to each left component of the rule in turn.
+// With tried given, the bindings of the last component which only use graphs from tried are skipped.
+// The intermediary rules made in a round are allocated from arenas which are released
+// when the rules have been deleted after the next round.
+void bindComponents(PrintSettings settings, Context context, const lib::Rules::Real &rRaw, const GraphState &input,
+                    const std::unordered_set<const lib::Graph::Single *> *tried) {
+	// declared before the rules, such that they outlive them in case of exceptions
+	std::vector<std::unique_ptr<RuleArenas> > arenas(rRaw.getDPORule().numLeftComponents + 1);
+	std::vector<std::vector<BoundRule> > intermediaryRules(rRaw.getDPORule().numLeftComponents + 1);
 	{
 		BoundRule p;
-		p.rule = rRaw;
+		p.rule = &rRaw;
+		p.owned = false;
 		intermediaryRules[0].push_back(p);
 	}
-	Context context{r, getExecutionEnv(), output, consumedGraphs};
 	const auto &subset = input.getSubset(0);
 	const auto &universe = input.getUniverse();
-	for(unsigned int i = 1; i <= rRaw->getDPORule().numLeftComponents; i++) {
+	for(unsigned int i = 1; i <= rRaw.getDPORule().numLeftComponents; i++) {
 		if(settings.verbosity >= PrintSettings::V_RuleBinding) {
 			settings.indent() << "Binding component " << i << " with ";
 			++settings.indentLevel;
@@ -252,19 +502,31 @@ void Rule::executeImpl(PrintSettings settings, const GraphState &input) {
 			}
 		}
 
+		Context contextComp = context;
+		// duplicates are found across all bindings of the component, not only within each composition
+		BoundRuleIndex intermediaries(context.executionEnv.labelSettings.type, context.executionEnv.labelSettings.withStereo);
+		if(i == rRaw.getDPORule().numLeftComponents) contextComp.tried = tried;
+		else contextComp.intermediaries = &intermediaries;
+		// the complete results are only kept when deferred, and then they must outlive the arenas
+		const bool useArenas = getConfig().dg.useRuleArena.get()
+		                       && !(i == rRaw.getDPORule().numLeftComponents && context.deferred);
+		arenas[i] = std::make_unique<RuleArenas>(useArenas);
+		contextComp.arenas = arenas[i].get();
+		contextComp.releaseArenas = i == rRaw.getDPORule().numLeftComponents;
 		std::size_t processedRules = 0;
 		if(i == 1) {
 			if(!getConfig().dg.ignoreSubset.get()) {
-				processedRules = bindGraphs(settings, context, subset, intermediaryRules[0], intermediaryRules[1]);
+				processedRules = bindGraphs(settings, contextComp, subset, intermediaryRules[0], intermediaryRules[1]);
 			} else {
-				processedRules = bindGraphs(settings, context, universe, intermediaryRules[0], intermediaryRules[1]);
+				processedRules = bindGraphs(settings, contextComp, universe, intermediaryRules[0], intermediaryRules[1]);
 			}
 		} else {
-			processedRules = bindGraphs(settings, context, universe, intermediaryRules[i - 1], intermediaryRules[i]);
+			processedRules = bindGraphs(settings, contextComp, universe, intermediaryRules[i - 1], intermediaryRules[i]);
 			for(BoundRule &p : intermediaryRules[i - 1]) {
-				delete p.rule;
+				deleteBoundRule(p);
 				p.rule = nullptr;
 			}
+			arenas[i - 1].reset();
 		}
 		if(settings.verbosity >= PrintSettings::V_RuleBinding) {
 			settings.indent() << "Processing of " << processedRules << " intermediary rules done" << std::endl;
@@ -275,6 +537,183 @@ void Rule::executeImpl(PrintSettings settings, const GraphState &input) {
 	assert(intermediaryRules.back().empty());
 }
 
+bool useDirectApplication(const ExecutionEnv &executionEnv) {
+	return executionEnv.ruleApplicationEngine == dg::RuleApplicationEngine::Direct
+	       && DirectRuleApplication::isSupported(executionEnv.labelSettings);
+}
+
+// As bindComponents, but the complete matches of the rule are found directly, without intermediary rules.
+void applyDirect(PrintSettings settings, Context context, const lib::Rules::Real &rRaw, const GraphState &input,
+                 const std::unordered_set<const lib::Graph::Single *> *tried) {
+	const auto &universe = input.getUniverse();
+	std::unordered_set<const lib::Graph::Single *> subset;
+	const bool useSubset = !getConfig().dg.ignoreSubset.get();
+	if(useSubset) {
+		const auto &s = input.getSubset(0);
+		subset.insert(s.begin(), s.end());
+	}
+	if(settings.verbosity >= PrintSettings::V_RuleBinding) {
+		settings.indent() << "Matching " << rRaw.getDPORule().numLeftComponents << " components directly into "
+		                  << universe.size() << " input graphs";
+		if(useSubset) settings.s << ", " << subset.size() << " in the subset";
+		settings.s << std::endl;
+	}
+	const auto labelSettings = context.executionEnv.labelSettings;
+	DirectRuleApplication app(rRaw, labelSettings, settings.verbosity >= PrintSettings::V_RCMorphismGenBase, settings);
+	app.apply(universe, useSubset ? &subset : nullptr, tried,
+	          [&](const std::vector<const lib::Graph::Single *> &educts, std::vector<GraphData> products) {
+		          ++context.statistics.derivations;
+		          handleDerivation(settings, context, rRaw.getName(), educts, [&]() {
+			          return wrapProducts(std::move(products), labelSettings.type, labelSettings.withStereo,
+			                              makeCheckIfNew(context), makeOnDuplicateProduct(settings));
+		          });
+		          return !context.executionEnv.doExit();
+	          });
+	context.statistics.bindingsTried += app.getNumComponentMatchings();
+	context.statistics.compositions += app.getNumMatches();
+	if(settings.verbosity >= PrintSettings::V_RuleBinding)
+		settings.indent() << "Found " << app.getNumMatches() << " matches" << std::endl;
+}
+
+} // namespace 
+
+void Rule::executeImpl(PrintSettings settings, const GraphState &input) {
+	const Stopwatch stopwatch;
+	if(settings.verbosity >= PrintSettings::V_Rule) {
+		settings.indent() << "Rule: " << r->getName() << std::endl;
+		++settings.indentLevel;
+	}
+
+	if(getExecutionEnv().labelSettings.withStereo) {
+		// let's trigger deduction errors early
+		try {
+			get_stereo(rRaw->getDPORule());
+		} catch(StereoDeductionError &e) {
+			std::stringstream ss;
+			ss << "\nStereo deduction error in rule '" << rRaw->getName() << "'.";
+			e.append(ss.str());
+			throw;
+		}
+	}
+	if(getExecutionEnv().labelSettings.type == LabelType::Term) {
+		const auto &term = get_term(rRaw->getDPORule());
+		if(!isValid(term)) {
+			std::string msg = "Parsing failed for rule '" + rRaw->getName() + "'. " + term.getParsingError();
+			throw TermParsingError(std::move(msg));
+		}
+	}
+
+	output = new GraphState(input.getUniverse());
+	if(getExecutionEnv().doExit()) {
+		if(settings.verbosity >= PrintSettings::V_Rule)
+			settings.indent() << "Exit requrested, skipping." << std::endl;
+		discardPrecomputed();
+		reportStatistics(stopwatch.seconds());
+		return;
+	}
+	if(hasPrecomputed(input)) {
+		std::vector<BoundRule> results = std::move(precomputed->results);
+		precomputed.reset();
+		Context context{r, getExecutionEnv(), output, consumedGraphs, nullptr, nullptr, nullptr, statistics};
+		std::vector<BoundRule> outputRules;
+		unsigned int processedRules = 0;
+		try {
+			processBoundRules(settings, context, results, outputRules, processedRules);
+		} catch(...) {
+			deleteBoundRules(std::vector<BoundRule>(results.begin() + processedRules, results.end()));
+			throw;
+		}
+		assert(outputRules.empty());
+		updateTried(input);
+		reportStatistics(stopwatch.seconds());
+		return;
+	}
+	discardPrecomputed();
+	Context context{r, getExecutionEnv(), output, consumedGraphs, nullptr, nullptr, nullptr, statistics};
+	if(useDirectApplication(getExecutionEnv()))
+		applyDirect(settings, context, *rRaw, input, getTriedBefore());
+	else
+		bindComponents(settings, context, *rRaw, input, getTriedBefore());
+	updateTried(input);
+	reportStatistics(stopwatch.seconds());
+}
+
+void Rule::reportStatistics(double time) {
+	statistics.time += time;
+	++statistics.executions;
+	// strategies made directly from a lib rule are only used internally
+	if(r) {
+		statistics.rule = r;
+		getExecutionEnv().addRuleStatistics(statistics);
+	}
+	statistics = dg::ExecuteStatistics::RuleStatistics();
+}
+
+const std::unordered_set<const lib::Graph::Single *> *Rule::getTriedBefore() const {
+	// without ignoreSubset not all bindings are tried in each round
+	if(!getConfig().dg.semiNaiveRepeat.get() || !getConfig().dg.ignoreSubset.get()) return nullptr;
+	return triedBefore.get();
+}
+
+void Rule::updateTried(const GraphState &input) {
+	triedBefore.reset();
+	if(!getConfig().dg.semiNaiveRepeat.get() || !getConfig().dg.ignoreSubset.get()) return;
+	// an interrupted execution may not have tried everything
+	if(getExecutionEnv().doExit()) return;
+	const auto &universe = input.getUniverse();
+	triedAfter = std::make_shared<const std::unordered_set<const lib::Graph::Single *> >(universe.begin(), universe.end());
+}
+
+bool Rule::canPrecompute(PrintSettings settings, const ExecutionEnv &executionEnv) {
+	// the precomputed results are intermediary rules
+	if(useDirectApplication(executionEnv)) return false;
+	// the binding output would be interleaved
+	if(settings.verbosity >= PrintSettings::V_RuleBinding) return false;
+	if(getConfig().rc.printMatches.get()) return false;
+	return true;
+}
+
+void Rule::prepareForPrecompute(const std::vector<Rule *> &strats, const GraphState &input,
+                                LabelSettings labelSettings) {
+	for(const Rule *strat : strats) {
+		if(labelSettings.withStereo) get_stereo(strat->rRaw->getDPORule());
+		lib::RC::prepareForComposition(*strat->rRaw, labelSettings);
+	}
+	const auto &universe = input.getUniverse();
+	lib::parallelForEach(universe.size(), [&](std::size_t i) {
+		prepareForBinding(*universe[i], labelSettings);
+	});
+}
+
+void Rule::precompute(PrintSettings settings, const GraphState &input) {
+	const Stopwatch stopwatch;
+	discardPrecomputed();
+	auto p = std::make_unique<Precomputed>();
+	p->input = &input;
+	if(!getExecutionEnv().doExit()) {
+		// products and derivations are only made in execute, so no output is needed
+		Context context{r, getExecutionEnv(), nullptr, consumedGraphs, &p->results, nullptr, nullptr, statistics};
+		try {
+			bindComponents(settings, context, *rRaw, input, getTriedBefore());
+		} catch(...) {
+			deleteBoundRules(p->results);
+			throw;
+		}
+	}
+	precomputed = std::move(p);
+	statistics.time += stopwatch.seconds();
+}
+
+bool Rule::hasPrecomputed(const GraphState &input) const {
+	return precomputed && precomputed->input == &input;
+}
+
+void Rule::discardPrecomputed() {
+	if(!precomputed) return;
+	deleteBoundRules(precomputed->results);
+	precomputed.reset();
+}
+
 } // namespace Strategies
 } // namespace DG
 } // namespace lib
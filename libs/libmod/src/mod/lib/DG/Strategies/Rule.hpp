@@ -3,6 +3,7 @@
 
 #include <mod/lib/DG/Strategies/Strategy.hpp>
 
+#include <memory>
 #include <unordered_set>
 
 namespace mod {
@@ -13,17 +14,42 @@ namespace Strategies {
 struct Rule : Strategy {
 	Rule(std::shared_ptr<rule::Rule> r);
 	Rule(const lib::Rules::Real *r);
+	virtual ~Rule() override;
 	virtual Strategy *clone() const override;
 	virtual void preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const override;
 	virtual void forEachRule(std::function<void(const lib::Rules::Real&)> f) const override;
 	virtual void printInfo(PrintSettings settings) const override;
+	virtual const char *getKind() const override { return "Rule"; }
 	virtual bool isConsumed(const lib::Graph::Single *g) const override;
+	virtual void continueFrom(Strategy &prevRound) override;
+public: // splitting the execution in a part without and a part with modification of the DG
+	// Whether precompute may be used with the given settings.
+	static bool canPrecompute(PrintSettings settings, const ExecutionEnv &executionEnv);
+	// Computes the lazily initialised data of the rules and input graphs which is accessed during precompute.
+	static void prepareForPrecompute(const std::vector<Rule *> &strats, const GraphState &input,
+	                                 LabelSettings labelSettings);
+	// Finds all the derivations of the rule on the input, but does not add them to the DG.
+	// The next execute on the same input then only adds them, exactly as if it had found them itself.
+	// Calls for different strategies may run concurrently, preferably after prepareForPrecompute.
+	void precompute(PrintSettings settings, const GraphState &input);
+	bool hasPrecomputed(const GraphState &input) const;
+	void discardPrecomputed();
 private:
 	virtual void executeImpl(PrintSettings settings, const GraphState &input) override;
+	const std::unordered_set<const lib::Graph::Single*> *getTriedBefore() const;
+	void updateTried(const GraphState &input);
+	// adds the statistics of this execution, including a precompute, to the execution environment
+	void reportStatistics(double time);
 private:
 	std::shared_ptr<rule::Rule> r;
 	const lib::Rules::Real *rRaw;
 	std::unordered_set<const lib::Graph::Single*> consumedGraphs; // all those from lhs of derivations
+	// for semi-naive repetition: all bindings using only graphs from these sets have been tried,
+	// respectively before and by this execution
+	std::shared_ptr<const std::unordered_set<const lib::Graph::Single*> > triedBefore, triedAfter;
+	struct Precomputed;
+	std::unique_ptr<Precomputed> precomputed;
+	dg::ExecuteStatistics::RuleStatistics statistics;
 };
 
 } // namespace Strategies
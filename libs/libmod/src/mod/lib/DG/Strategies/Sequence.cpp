@@ -52,6 +52,13 @@ bool Sequence::isConsumed(const Graph::Single *g) const {
 	return false;
 }
 
+void Sequence::continueFrom(Strategy &prevRound) {
+	auto *prev = dynamic_cast<Sequence *>(&prevRound);
+	if(!prev || prev->strats.size() != strats.size()) return;
+	for(std::size_t i = 0; i != strats.size(); ++i)
+		strats[i]->continueFrom(*prev->strats[i]);
+}
+
 void Sequence::setExecutionEnvImpl() {
 	for(Strategy *strat : strats) strat->setExecutionEnv(getExecutionEnv());
 }
@@ -18,8 +18,10 @@ struct Sequence : Strategy {
 	virtual void preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const override;
 	virtual void forEachRule(std::function<void(const lib::Rules::Real &)> f) const override;
 	virtual void printInfo(PrintSettings settings) const override;
+	virtual const char *getKind() const override { return "Sequence"; }
 	virtual const GraphState &getOutput() const override;
 	virtual bool isConsumed(const lib::Graph::Single *g) const override;
+	virtual void continueFrom(Strategy &prevRound) override;
 private:
 	virtual void setExecutionEnvImpl() override;
 	virtual void executeImpl(PrintSettings settings, const GraphState &input) override;
@@ -5,6 +5,10 @@
 #include <mod/lib/DG/Strategies/GraphState.hpp>
 #include <mod/lib/Graph/Single.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
 namespace mod {
 namespace lib {
 namespace DG {
@@ -13,8 +17,12 @@ namespace Strategies {
 Sort::Sort(std::shared_ptr<mod::Function<bool(std::shared_ptr<graph::Graph>, std::shared_ptr<graph::Graph>, const dg::Strategy::GraphState&)> > less, bool doUniverse)
 : Strategy(0), less(less), doUniverse(doUniverse) { }
 
+Sort::Sort(std::shared_ptr<mod::Function<double(std::shared_ptr<graph::Graph>)> > key, bool doUniverse)
+: Strategy(0), key(key), doUniverse(doUniverse) { }
+
 Strategy *Sort::clone() const {
-	return new Sort(less->clone(), doUniverse);
+	if(less) return new Sort(less->clone(), doUniverse);
+	else return new Sort(key->clone(), doUniverse);
 }
 
 void Sort::preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy) > add) const { }
@@ -25,8 +33,8 @@ void Sort::printInfo(PrintSettings settings) const {
 	if(doUniverse) s << " universe";
 	s << '\n';
 	++settings.indentLevel;
-	settings.indent() << "evaluation function = ";
-	less->print(s);
+	settings.indent() << (less ? "evaluation function = " : "key = ");
+	printFunction(s);
 	s << '\n';
 	printBaseInfo(settings);
 }
@@ -38,32 +46,54 @@ bool Sort::isConsumed(const lib::Graph::Single *g) const {
 void Sort::executeImpl(PrintSettings settings, const GraphState &input) {
 	if(getConfig().dg.calculateVerbose.get()) {
 		settings.indent() << "Sort: ";
-		less->print(settings.s);
+		printFunction(settings.s);
 		settings.s << std::endl;
 		++settings.indentLevel;
 	}
 
 	assert(!output);
-	dg::Strategy::GraphState gs(
-			[&input](std::vector<std::shared_ptr<graph::Graph> > &subset) {
-				for(const lib::Graph::Single *g : input.getSubset(0)) subset.push_back(g->getAPIReference());
-			},
-	[&input](std::vector<std::shared_ptr<graph::Graph> > &universe) {
-		for(const lib::Graph::Single *g : input.getUniverse()) universe.push_back(g->getAPIReference());
-	});
-	auto comp = [&gs, this](const lib::Graph::Single *g1, const lib::Graph::Single * g2) -> bool {
-		return (*less)(g1->getAPIReference(), g2->getAPIReference(), gs);
-	};
-
 	output = new GraphState(input);
 	assert(output->hasSubset(0)); // TODO: remove when the sorting is parameterized with the subset index
 	assert(output->getSubsets().size() == 1);
-	if(doUniverse) output->sortUniverse(comp);
-	else output->sortSubset(0, comp); // TODO: put the subset index here
+	if(key) {
+		// each key is computed once, instead of calling back for each comparison
+		std::unordered_map<const lib::Graph::Single *, double> keys;
+		const auto addKey = [&keys, this](const lib::Graph::Single *g) {
+			keys.emplace(g, (*key)(g->getAPIReference()));
+		};
+		if(doUniverse) std::for_each(input.getUniverse().begin(), input.getUniverse().end(), addKey);
+		else std::for_each(input.getSubset(0).begin(), input.getSubset(0).end(), addKey);
+		// NaN keys are ordered last, so the order stays strict weak
+		auto comp = [&keys](const lib::Graph::Single *g1, const lib::Graph::Single *g2) -> bool {
+			const double k1 = keys.find(g1)->second;
+			const double k2 = keys.find(g2)->second;
+			return k1 < k2 || (std::isnan(k2) && !std::isnan(k1));
+		};
+		if(doUniverse) output->sortUniverse(comp);
+		else output->sortSubset(0, comp); // TODO: put the subset index here
+	} else {
+		dg::Strategy::GraphState gs(
+				[&input](std::vector<std::shared_ptr<graph::Graph> > &subset) {
+					for(const lib::Graph::Single *g : input.getSubset(0)) subset.push_back(g->getAPIReference());
+				},
+				[&input](std::vector<std::shared_ptr<graph::Graph> > &universe) {
+					for(const lib::Graph::Single *g : input.getUniverse()) universe.push_back(g->getAPIReference());
+				});
+		auto comp = [&gs, this](const lib::Graph::Single *g1, const lib::Graph::Single * g2) -> bool {
+			return (*less)(g1->getAPIReference(), g2->getAPIReference(), gs);
+		};
+		if(doUniverse) output->sortUniverse(comp);
+		else output->sortSubset(0, comp); // TODO: put the subset index here
+	}
 	if(getConfig().dg.calculateVerbose.get())
 		--settings.indentLevel;
 }
 
+void Sort::printFunction(std::ostream &s) const {
+	if(less) less->print(s);
+	else key->print(s);
+}
+
 } // namespace Strategies
 } // namespace DG
 } // namespace lib
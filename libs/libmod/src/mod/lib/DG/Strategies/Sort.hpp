@@ -11,15 +11,21 @@ namespace Strategies {
 
 struct Sort : Strategy {
 	Sort(std::shared_ptr<mod::Function<bool(std::shared_ptr<graph::Graph>, std::shared_ptr<graph::Graph>, const dg::Strategy::GraphState&)> > less, bool doUniverse);
+	// Sorts in increasing order of the key, which is computed once for each graph.
+	Sort(std::shared_ptr<mod::Function<double(std::shared_ptr<graph::Graph>)> > key, bool doUniverse);
 	virtual Strategy *clone() const override;
 	virtual void preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const override;
 	virtual void forEachRule(std::function<void(const lib::Rules::Real&) > f) const override { }
 	virtual void printInfo(PrintSettings settings) const override;
+	virtual const char *getKind() const override { return "Sort"; }
 	virtual bool isConsumed(const lib::Graph::Single *g) const override;
 private:
 	virtual void executeImpl(PrintSettings settings, const GraphState &input) override;
+	void printFunction(std::ostream &s) const;
 private:
+	// exactly one of them is set
 	std::shared_ptr<mod::Function<bool(std::shared_ptr<graph::Graph>, std::shared_ptr<graph::Graph>, const dg::Strategy::GraphState&)> > less;
+	std::shared_ptr<mod::Function<double(std::shared_ptr<graph::Graph>)> > key;
 	const bool doUniverse;
 };
 
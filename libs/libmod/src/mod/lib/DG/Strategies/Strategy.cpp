@@ -3,6 +3,7 @@
 #include <mod/Config.hpp>
 #include <mod/lib/DG/Strategies/GraphState.hpp>
 #include <mod/lib/Graph/Single.hpp>
+#include <mod/lib/Stopwatch.hpp>
 
 namespace mod {
 namespace lib {
@@ -28,9 +29,13 @@ unsigned int Strategy::getMaxComponents() const {
 void Strategy::execute(PrintSettings settings, const GraphState &input) {
 	assert(env);
 	this->input = &input;
+	const Stopwatch stopwatch;
 	executeImpl(settings, input);
+	env->addStrategyTime(getKind(), stopwatch.seconds());
 }
 
+void Strategy::continueFrom(Strategy &prevRound) {}
+
 const GraphState &Strategy::getOutput() const {
 	assert(output);
 	assert(output->hasSubset(0));
@@ -1,6 +1,8 @@
 #ifndef MOD_LIB_DG_STRATEGIES_STRATEGY_H
 #define MOD_LIB_DG_STRATEGIES_STRATEGY_H
 
+#include <mod/dg/Builder.hpp>
+#include <mod/dg/ExecuteStatistics.hpp>
 #include <mod/dg/Strategies.hpp>
 #include <mod/lib/DG/NonHyper.hpp>
 #include <mod/lib/IO/IO.hpp>
@@ -11,11 +13,13 @@
 namespace mod {
 namespace lib {
 namespace DG {
+struct CompositionCache;
 namespace Strategies {
 class GraphState;
 
 struct ExecutionEnv {
-	ExecutionEnv(LabelSettings labelSettings) : labelSettings(labelSettings) {}
+	ExecutionEnv(LabelSettings labelSettings, dg::RuleApplicationEngine ruleApplicationEngine)
+			: labelSettings(labelSettings), ruleApplicationEngine(ruleApplicationEngine) {}
 
 	virtual ~ExecutionEnv() {};
 	// May throw LogicError if exists.
@@ -38,8 +42,14 @@ struct ExecutionEnv {
 	virtual void pushRightPredicate(std::shared_ptr<mod::Function<bool(const mod::Derivation &)> > pred) = 0;
 	virtual void popLeftPredicate() = 0;
 	virtual void popRightPredicate() = 0;
+	// Returns nullptr if composition results should not be memoised.
+	virtual CompositionCache *getCompositionCache() = 0;
+	// Statistics must not be added from within parallel tasks.
+	virtual void addRuleStatistics(const dg::ExecuteStatistics::RuleStatistics &stats) = 0;
+	virtual void addStrategyTime(const char *kind, double time) = 0;
 public:
 	const LabelSettings labelSettings;
+	const dg::RuleApplicationEngine ruleApplicationEngine;
 };
 
 struct PrintSettings : IO::Logger {
@@ -84,8 +94,14 @@ struct Strategy {
 	unsigned int getMaxComponents() const;
 	void execute(PrintSettings settings, const GraphState &input);
 	virtual void printInfo(PrintSettings settings) const = 0;
+	// The name used for the strategy in the execution statistics.
+	virtual const char *getKind() const = 0;
 	virtual const GraphState &getOutput() const;
 	virtual bool isConsumed(const lib::Graph::Single *g) const = 0;
+	// Called by a semi-naive Repeat on the clone for the next round,
+	// with the same strategy as executed in the previous round, from which state may be moved.
+	// The default does nothing, i.e., the next round starts from scratch.
+	virtual void continueFrom(Strategy &prevRound);
 protected:
 	ExecutionEnv &getExecutionEnv();
 	void printBaseInfo(PrintSettings settings) const;
@@ -15,6 +15,7 @@ struct Take : Strategy {
 	virtual void preAddGraphs(std::function<void(std::shared_ptr<graph::Graph>, IsomorphismPolicy)> add) const override;
 	virtual void forEachRule(std::function<void(const lib::Rules::Real &)> f) const override {}
 	virtual void printInfo(PrintSettings settings) const override;
+	virtual const char *getKind() const override { return "Take"; }
 	virtual bool isConsumed(const Graph::Single *g) const override;
 private:
 	virtual void executeImpl(PrintSettings settings, const GraphState &input) override;
@@ -23,8 +23,11 @@
 
 #include <jla_boost/graph/PairToRangeAdaptor.hpp>
 
+#include <boost/functional/hash.hpp>
 #include <boost/graph/graph_utility.hpp> // for boost::print_graph
 
+#include <set>
+#include <tuple>
 #include <vector>
 
 namespace mod {
@@ -598,6 +601,43 @@ getCanonForm(const Single &g, LabelType labelType, bool withStereo) {
 	}
 }
 
+bool canCanonicalise(const Single &g, LabelType labelType, bool withStereo) {
+	if(labelType != LabelType::String) return false;
+	if(withStereo) return false;
+	const auto &mol = get_molecule(g.getLabelledGraph());
+	const auto es = edges(g.getGraph());
+	return std::all_of(es.first, es.second, [&](const auto &e) {
+		return mol[e] != BondType::Invalid;
+	});
+}
+
+std::size_t getCanonHash(const Single &g, const std::vector<int> &perm) {
+	const auto &graph = g.getGraph();
+	const auto &str = g.getStringState();
+	const auto idx = get(boost::vertex_index_t(), graph);
+	assert(perm.size() == num_vertices(graph));
+	std::vector<std::size_t> vertexHashes(num_vertices(graph));
+	for(const auto v : asRange(vertices(graph)))
+		vertexHashes[perm[idx[v]]] = std::hash<std::string>()(str[v]);
+	std::vector<std::tuple<int, int, std::size_t> > edgeHashes;
+	edgeHashes.reserve(num_edges(graph));
+	for(const auto e : asRange(edges(graph))) {
+		int src = perm[idx[source(e, graph)]];
+		int tar = perm[idx[target(e, graph)]];
+		if(src > tar) std::swap(src, tar);
+		edgeHashes.emplace_back(src, tar, std::hash<std::string>()(str[e]));
+	}
+	std::sort(edgeHashes.begin(), edgeHashes.end());
+	std::size_t res = vertexHashes.size();
+	boost::hash_range(res, vertexHashes.begin(), vertexHashes.end());
+	for(const auto &e : edgeHashes) {
+		boost::hash_combine(res, std::get<0>(e));
+		boost::hash_combine(res, std::get<1>(e));
+		boost::hash_combine(res, std::get<2>(e));
+	}
+	return res;
+}
+
 namespace {
 
 template<typename LGraph, typename Graph, typename Idx>
@@ -692,6 +732,40 @@ bool canonicalCompare(const Single &g1, const Single &g2, LabelType labelType, b
 	MOD_ABORT;
 }
 
+Single::AutPerms getAutPerms(const Single &g, const Single::AutGroup &group, std::size_t maxPerms) {
+	using Perm = std::vector<std::size_t>;
+	const std::size_t n = num_vertices(g.getGraph());
+	Perm identity(n);
+	for(std::size_t i = 0; i != n; ++i) identity[i] = i;
+
+	std::vector<Perm> gens;
+	const auto &groupGens = group.generators();
+	for(std::size_t i = 0; i != groupGens.size(); ++i) {
+		Perm p(n);
+		for(std::size_t v = 0; v != n; ++v)
+			p[v] = perm_group::get(groupGens[i], v);
+		if(p != identity) gens.push_back(std::move(p));
+	}
+	// the elements are found in order of increasing word length, so a truncation keeps the short products
+	std::vector<Perm> perms;
+	std::set<Perm> seen{identity};
+	for(const Perm &p : gens) {
+		if(perms.size() == maxPerms) break;
+		if(seen.insert(p).second) perms.push_back(p);
+	}
+	for(std::size_t i = 0; i != perms.size() && perms.size() < maxPerms; ++i) {
+		for(const Perm &gen : gens) {
+			Perm p(n);
+			for(std::size_t v = 0; v != n; ++v)
+				p[v] = gen[perms[i][v]];
+			if(!seen.insert(p).second) continue;
+			perms.push_back(std::move(p));
+			if(perms.size() == maxPerms) break;
+		}
+	}
+	return perms;
+}
+
 } // namespace Graph
 } // namespace lib
 } // namespace mod
@@ -12,6 +12,15 @@ getCanonForm(const Single &g, LabelType labelType, bool withStereo);
 
 bool canonicalCompare(const Single &g1, const Single &g2, LabelType labelType, bool withStereo);
 
+// Whether getCanonForm can canonicalise the graph with the given settings, instead of throwing an exception.
+bool canCanonicalise(const Single &g, LabelType labelType, bool withStereo);
+// A hash of the graph relabelled by the canonical permutation (as returned by getCanonForm),
+// i.e., graphs with equal canonical forms have equal hashes.
+std::size_t getCanonHash(const Single &g, const std::vector<int> &perm);
+// The elements of the automorphism group of g other than the identity, as vertex index permutations,
+// found by a breadth-first closure of the generators and truncated to at most maxPerms elements.
+Single::AutPerms getAutPerms(const Single &g, const Single::AutGroup &group, std::size_t maxPerms);
+
 } // namespace Graph
 } // namespace lib
 } // namespace mod
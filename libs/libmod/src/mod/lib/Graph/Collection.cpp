@@ -1,65 +1,17 @@
 #include "Collection.hpp"
 
 #include <mod/Error.hpp>
+#include <mod/lib/Graph/Canonicalisation.hpp>
+#include <mod/lib/Graph/Invariants.hpp>
 #include <mod/lib/Graph/Single.hpp>
 
 namespace mod {
 namespace lib {
 namespace Graph {
-namespace {
-
-inline CollectionStats getStats(const lib::Graph::Single *g) {
-	const auto &graph = g->getGraph();
-	return {num_vertices(graph), num_edges(graph)};
-}
-
-
-} // namespace
-
-struct Collection::Store {
-	bool trustInsert(const lib::Graph::Single *g) {
-		return graphs.insert(g).second;
-	}
-
-	auto end() const {
-		return graphs.end();
-	}
-
-	auto find(const lib::Graph::Single *g) const {
-		return graphs.find(g);
-	}
-
-	std::shared_ptr<graph::Graph> findIsomorphic(const lib::Graph::Single *g, LabelSettings ls) const {
-		for(const auto &gCand : graphs) {
-			const bool iso = lib::Graph::Single::isomorphic(*g, *gCand, ls);
-			if(iso) return gCand->getAPIReference();
-			// if iso:
-			//			if(getConfig().dg.calculateDetailsVerbose.get()) {
-			//				IO::log() << "Discarding product " << gCand->getName() << ", isomorphic to " << g->getName() << std::endl;
-			//				IO::log() << "\tLabelSettings: withStereo=" << std::boolalpha << this->labelSettings.withStereo << std::endl;
-			//				mod::postSection("Discarded");
-			//				mod::lib::IO::Graph::Write::Options opts, optsGraph;
-			//				opts.edgesAsBonds = opts.withIndex = true;
-			//				optsGraph.collapseHydrogens = optsGraph.edgesAsBonds = optsGraph.raiseCharges = true;
-			//				optsGraph.simpleCarbons = optsGraph.withColour = optsGraph.withIndex = true;
-			//				mod::lib::IO::Graph::Write::summary(*gCand, optsGraph, optsGraph);
-			//				std::shared_ptr<graph::Graph> gCandWrapped = graph::Graph::makeGraph(std::move(gCand));
-			//				for(auto v : gCandWrapped->vertices()) {
-			//					if(v.getStringLabel() == "C")
-			//						v.printStereo();
-			//				}
-			//			}
-		}
-		return nullptr;
-	}
-
-private:
-	std::unordered_set<const lib::Graph::Single *> graphs;
-};
 
 Collection::Collection(LabelSettings ls, Config::IsomorphismAlg alg)
 		: ls(ls.type, LabelRelation::Isomorphism,
-			  ls.withStereo, LabelRelation::Isomorphism) {}
+			  ls.withStereo, LabelRelation::Isomorphism), alg(alg) {}
 
 Collection::~Collection() = default;
 
@@ -68,54 +20,88 @@ const std::vector<std::shared_ptr<graph::Graph>> &Collection::asList() const {
 }
 
 bool Collection::contains(std::shared_ptr<graph::Graph> g) const {
-	const auto *gLib = &g->getGraph();
-	const auto stats = getStats(gLib);
-	const auto iterStore = graphStore.find(stats);
-	if(iterStore == end(graphStore)) return false;
-	const auto iterGraph = iterStore->second->find(gLib);
-	return iterGraph != iterStore->second->end();
+	return graphSet.find(&g->getGraph()) != graphSet.end();
 }
 
 std::shared_ptr<graph::Graph> Collection::findIsomorphic(std::shared_ptr<graph::Graph> g) const {
 	const auto *gLib = &g->getGraph();
-	const auto stats = getStats(gLib);
-	const auto iterStore = graphStore.find(stats);
-	if(iterStore == end(graphStore)) return nullptr;
-	const auto iterGraph = iterStore->second->find(gLib);
-	if(iterGraph != iterStore->second->end()) return g;
-	return iterStore->second->findIsomorphic(gLib, ls);
+	if(graphSet.find(gLib) != graphSet.end()) return g;
+	return findIsomorphic(gLib, getStats(gLib));
 }
 
 std::shared_ptr<graph::Graph> Collection::findIsomorphic(lib::Graph::Single *g) const {
-	const auto stats = getStats(g);
-	const auto iterStore = graphStore.find(stats);
-	if(iterStore == end(graphStore)) return nullptr;
-	return iterStore->second->findIsomorphic(g, ls);
+	return findIsomorphic(g, getStats(g));
 }
 
 bool Collection::trustInsert(std::shared_ptr<graph::Graph> g) {
-	const auto *gLib = &g->getGraph();
-	const auto stats = getStats(gLib);
-	auto iterStore = graphStore.find(stats);
-	if(iterStore == end(graphStore)) {
-		iterStore = graphStore.emplace(stats, std::make_unique<Store>()).first;
-		iterStore->second->trustInsert(gLib);
-		graphs.push_back(g);
-		return true;
-	} else {
-		const bool res = iterStore->second->trustInsert(gLib);
-		if(res) graphs.push_back(g);
-		return res;
-	}
+	if(contains(g)) return false;
+	return trustInsert(g, getStats(&g->getGraph()));
 }
 
 std::pair<std::shared_ptr<graph::Graph>, bool> Collection::tryInsert(std::shared_ptr<graph::Graph> g) {
-	const auto gIns = findIsomorphic(g);
+	const auto *gLib = &g->getGraph();
+	if(graphSet.find(gLib) != graphSet.end()) return {g, false};
+	const auto stats = getStats(gLib);
+	const auto gIns = findIsomorphic(gLib, stats);
 	if(gIns) return {gIns, false};
-	trustInsert(g);
+	trustInsert(g, stats);
 	return {g, true};
 }
 
+CollectionStats Collection::getStats(const lib::Graph::Single *g) const {
+	const auto &graph = g->getGraph();
+	// the canonical form does not include stereo information,
+	// so with stereo we bucket by the canonical form of the underlying graph and a stereo invariant
+	const bool useCanon = alg == Config::IsomorphismAlg::Canon
+			&& num_vertices(graph) != 0
+			&& canCanonicalise(*g, ls.type, false);
+	auto invariant = useCanon
+			? g->getCanonHash(ls.type, false)
+			: getInvariantHash(*g, ls.type);
+	if(ls.withStereo && num_vertices(graph) != 0)
+		boost::hash_combine(invariant, getStereoInvariantHash(*g, ls.type));
+	return {num_vertices(graph), num_edges(graph), invariant};
+}
+
+std::size_t Collection::getKeySignature() const {
+	// the hash functions are implementation defined, so probe them as well
+	std::size_t res = 2; // bump when getStats, getInvariantHash, or getCanonHash change
+	// the canonical order, and thereby getCanonHash, depends on the GraphCanon version
+	boost::hash_combine(res, std::string(MOD_VERSION));
+	boost::hash_combine(res, std::string(MOD_GRAPH_CANON_VERSION));
+	boost::hash_combine(res, static_cast<int>(ls.type));
+	boost::hash_combine(res, ls.withStereo);
+	boost::hash_combine(res, alg == Config::IsomorphismAlg::Canon);
+	boost::hash_combine(res, std::hash<std::string>()("C"));
+	return res;
+}
+
+std::shared_ptr<graph::Graph> Collection::findIsomorphic(const lib::Graph::Single *g, CollectionStats stats) const {
+	auto &config = getConfig().graph;
+	const auto iterStore = graphStore.find(stats);
+	if(iterStore != graphStore.end()) {
+		for(const auto *gCand : iterStore->second) {
+			config.numCollectionConfirmations.increment();
+			const bool iso = lib::Graph::Single::isomorphic(*g, *gCand, ls, alg);
+			if(iso) {
+				config.numCollectionHits.increment();
+				return gCand->getAPIReference();
+			}
+		}
+	}
+	config.numCollectionMisses.increment();
+	return nullptr;
+}
+
+bool Collection::trustInsert(std::shared_ptr<graph::Graph> g, CollectionStats stats) {
+	const auto *gLib = &g->getGraph();
+	const bool inserted = graphSet.insert(gLib).second;
+	if(!inserted) return false;
+	graphStore[stats].push_back(gLib);
+	graphs.push_back(g);
+	return true;
+}
+
 } // namespace Graph
 } // namespace lib
 } // namespace mod
\ No newline at end of file
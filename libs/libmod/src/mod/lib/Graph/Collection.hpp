@@ -16,9 +16,11 @@ namespace Graph {
 struct CollectionStats {
 	std::size_t numVertices;
 	std::size_t numEdges;
+	// either getInvariantHash or Single::getCanonHash, depending on the collection
+	std::size_t invariant;
 public:
 	friend bool operator==(CollectionStats a, CollectionStats b) {
-		return std::tie(a.numVertices, a.numEdges) == std::tie(b.numVertices, b.numEdges);
+		return std::tie(a.numVertices, a.numEdges, a.invariant) == std::tie(b.numVertices, b.numEdges, b.invariant);
 	}
 };
 } // namespace Graph
@@ -30,6 +32,7 @@ struct std::hash<mod::lib::Graph::CollectionStats> {
 	std::size_t operator()(mod::lib::Graph::CollectionStats stats) const {
 		std::size_t res = stats.numVertices;
 		boost::hash_combine(res, stats.numEdges);
+		boost::hash_combine(res, stats.invariant);
 		return res;
 	}
 };
@@ -38,6 +41,10 @@ namespace mod {
 namespace lib {
 namespace Graph {
 
+// Graphs are indexed by an isomorphism invariant hash, so lookups only need to confirm
+// isomorphism for the few graphs with the same hash.
+// With Config::IsomorphismAlg::Canon the hash of the canonical form is used when possible,
+// otherwise the Weisfeiler-Lehman-based hash from getInvariantHash.
 struct Collection {
 	explicit Collection(LabelSettings ls, Config::IsomorphismAlg alg);
 	~Collection();
@@ -61,10 +68,21 @@ public:
 	// If inserted, return g, otherwise return an isomorphic graph.
 	// Note: if the same graph object is already present, the return value is <g, false>.
 	std::pair<std::shared_ptr<graph::Graph>, bool> tryInsert(std::shared_ptr<graph::Graph> g);
+public: // with precomputed keys, e.g., loaded from a dump
+	// The key used for indexing g.
+	CollectionStats getStats(const lib::Graph::Single *g) const;
+	// Identifies how getStats computes keys, i.e., the label settings, the algorithm, and the hash functions.
+	// Keys from collections with different signatures can not be compared.
+	std::size_t getKeySignature() const;
+	// Requires: stats == getStats(g)
+	std::shared_ptr<graph::Graph> findIsomorphic(const lib::Graph::Single *g, CollectionStats stats) const;
+	// Requires: stats == getStats(&g->getGraph())
+	bool trustInsert(std::shared_ptr<graph::Graph> g, CollectionStats stats);
 private:
-	struct Store;
 	const LabelSettings ls;
-	std::unordered_map<CollectionStats, std::unique_ptr<Store>> graphStore;
+	const Config::IsomorphismAlg alg;
+	std::unordered_map<CollectionStats, std::vector<const lib::Graph::Single *>> graphStore;
+	std::unordered_set<const lib::Graph::Single *> graphSet;
 	// owning part
 	std::vector<std::shared_ptr<graph::Graph>> graphs;
 };
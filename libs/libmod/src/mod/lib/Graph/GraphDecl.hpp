@@ -1,13 +1,14 @@
 #ifndef MOD_LIB_GRAPH_GRAPHDECL_H
 #define MOD_LIB_GRAPH_GRAPHDECL_H
 
-#include <jla_boost/graph/EdgeIndexedAdjacencyList.hpp>
+#include <jla_boost/graph/EdgeIndexedCSRGraph.hpp>
 
 namespace mod {
 namespace lib {
 namespace Graph {
 
-using GraphType = jla_boost::EdgeIndexedAdjacencyList<boost::undirectedS>;
+// graphs are built incrementally and then frozen by LabelledGraph, as they are immutable from then on
+using GraphType = jla_boost::EdgeIndexedCSRGraph<boost::undirectedS>;
 using Vertex = boost::graph_traits<GraphType>::vertex_descriptor;
 using Edge = boost::graph_traits<GraphType>::edge_descriptor;
 
@@ -0,0 +1,167 @@
+#include "Invariants.hpp"
+
+#include <mod/lib/Graph/Single.hpp>
+#include <mod/lib/Graph/Properties/Stereo.hpp>
+#include <mod/lib/Graph/Properties/String.hpp>
+
+#include <jla_boost/graph/PairToRangeAdaptor.hpp>
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace mod {
+namespace lib {
+namespace Graph {
+
+std::size_t getInvariantHash(const Single &g, LabelType labelType) {
+	const auto &graph = g.getGraph();
+	const auto &pString = g.getStringState();
+	const auto n = num_vertices(graph);
+	if(n == 0) return 0;
+	const bool withLabels = labelType == LabelType::String;
+	const auto idx = get(boost::vertex_index_t(), graph);
+
+	std::vector<std::size_t> edgeColour(num_edges(graph), 0);
+	if(withLabels) {
+		for(const auto e : asRange(edges(graph)))
+			edgeColour[get(boost::edge_index_t(), graph, e)] = std::hash<std::string>()(pString[e]);
+	}
+	std::vector<std::size_t> colour(n), nextColour(n);
+	for(const auto v : asRange(vertices(graph))) {
+		std::size_t c = withLabels ? std::hash<std::string>()(pString[v]) : 0;
+		boost::hash_combine(c, out_degree(v, graph));
+		colour[idx[v]] = c;
+	}
+	// a few rounds are enough to separate most non-isomorphic molecules of the same size
+	constexpr int numRounds = 3;
+	std::vector<std::size_t> neighbourhood;
+	for(int round = 0; round != numRounds; ++round) {
+		for(const auto v : asRange(vertices(graph))) {
+			neighbourhood.clear();
+			for(const auto e : asRange(out_edges(v, graph))) {
+				std::size_t c = colour[idx[target(e, graph)]];
+				boost::hash_combine(c, edgeColour[get(boost::edge_index_t(), graph, e)]);
+				neighbourhood.push_back(c);
+			}
+			std::sort(neighbourhood.begin(), neighbourhood.end());
+			std::size_t c = colour[idx[v]];
+			boost::hash_range(c, neighbourhood.begin(), neighbourhood.end());
+			nextColour[idx[v]] = c;
+		}
+		colour.swap(nextColour);
+	}
+	std::sort(colour.begin(), colour.end());
+	std::size_t res = n;
+	boost::hash_combine(res, num_edges(graph));
+	boost::hash_range(res, colour.begin(), colour.end());
+	return res;
+}
+
+std::size_t getStereoInvariantHash(const Single &g, LabelType labelType) {
+	const auto &graph = g.getGraph();
+	const auto &pString = g.getStringState();
+	const auto &pStereo = get_stereo(g.getLabelledGraph());
+	const bool withLabels = labelType == LabelType::String;
+	std::vector<std::size_t> vertexHashes;
+	vertexHashes.reserve(num_vertices(graph));
+	for(const auto v : asRange(vertices(graph))) {
+		std::size_t h = withLabels ? std::hash<std::string>()(pString[v]) : 0;
+		boost::hash_combine(h, pStereo[v]->getGeometryVertex());
+		vertexHashes.push_back(h);
+	}
+	std::sort(vertexHashes.begin(), vertexHashes.end());
+	return boost::hash_range(vertexHashes.begin(), vertexHashes.end());
+}
+
+namespace {
+
+// True iff the i'th largest of dom is at most the i'th largest of codom for all i,
+// i.e., iff the elements of dom can be injectively mapped to elements of codom which are at least as large.
+// pre: both are sorted in descending order
+bool dominated(const std::vector<unsigned int> &dom, const std::vector<unsigned int> &codom) {
+	if(dom.size() > codom.size()) return false;
+	return std::equal(dom.begin(), dom.end(), codom.begin(), [](unsigned int d, unsigned int c) {
+		return d <= c;
+	});
+}
+
+} // namespace
+
+GraphInvariants getInvariants(const Single &g) {
+	const auto &graph = g.getGraph();
+	const auto &pString = g.getStringState();
+	GraphInvariants res;
+	std::map<std::size_t, std::vector<unsigned int> > labelDegrees;
+	for(const auto v : asRange(vertices(graph))) {
+		const unsigned int d = out_degree(v, graph);
+		res.degrees.push_back(d);
+		labelDegrees[get_label_id(pString, v)].push_back(d);
+	}
+	std::map<std::size_t, unsigned int> edgeLabelCounts;
+	for(const auto e : asRange(edges(graph)))
+		++edgeLabelCounts[get_label_id(pString, e)];
+
+	const auto descending = [](std::vector<unsigned int> &ds) {
+		std::sort(ds.begin(), ds.end(), std::greater<unsigned int>());
+	};
+	descending(res.degrees);
+	for(auto &p : labelDegrees) {
+		descending(p.second);
+		res.labelDegrees.emplace_back(p.first, std::move(p.second));
+	}
+	res.edgeLabelCounts.assign(edgeLabelCounts.begin(), edgeLabelCounts.end());
+
+	res.labelHash = 0;
+	for(const auto &p : res.labelDegrees) {
+		boost::hash_combine(res.labelHash, p.first);
+		boost::hash_combine(res.labelHash, p.second.size());
+	}
+	for(const auto &p : res.edgeLabelCounts) {
+		boost::hash_combine(res.labelHash, p.first);
+		boost::hash_combine(res.labelHash, p.second);
+	}
+	res.degreeHash = boost::hash_range(res.degrees.begin(), res.degrees.end());
+	res.profileHash = res.degreeHash;
+	for(const auto &p : res.labelDegrees) {
+		boost::hash_combine(res.profileHash, p.first);
+		boost::hash_range(res.profileHash, p.second.begin(), p.second.end());
+	}
+	boost::hash_combine(res.profileHash, res.labelHash);
+	return res;
+}
+
+bool mayBeIsomorphic(const GraphInvariants &gDom, const GraphInvariants &gCodom, LabelSettings labelSettings) {
+	// with term labels, different labels may still match
+	if(labelSettings.type == LabelType::String)
+		return gDom.profileHash == gCodom.profileHash;
+	else
+		return gDom.degreeHash == gCodom.degreeHash;
+}
+
+bool mayBeMonomorphic(const GraphInvariants &gDom, const GraphInvariants &gCodom, LabelSettings labelSettings) {
+	if(!dominated(gDom.degrees, gCodom.degrees)) return false;
+	if(labelSettings.type != LabelType::String) return true;
+	// both are sorted by label, so merge them
+	auto iterCodom = gCodom.labelDegrees.begin();
+	for(const auto &p : gDom.labelDegrees) {
+		while(iterCodom != gCodom.labelDegrees.end() && iterCodom->first < p.first) ++iterCodom;
+		if(iterCodom == gCodom.labelDegrees.end() || iterCodom->first != p.first) return false;
+		if(!dominated(p.second, iterCodom->second)) return false;
+	}
+	auto iterCodomEdge = gCodom.edgeLabelCounts.begin();
+	for(const auto &p : gDom.edgeLabelCounts) {
+		while(iterCodomEdge != gCodom.edgeLabelCounts.end() && iterCodomEdge->first < p.first) ++iterCodomEdge;
+		if(iterCodomEdge == gCodom.edgeLabelCounts.end() || iterCodomEdge->first != p.first) return false;
+		if(p.second > iterCodomEdge->second) return false;
+	}
+	return true;
+}
+
+} // namespace Graph
+} // namespace lib
+} // namespace mod
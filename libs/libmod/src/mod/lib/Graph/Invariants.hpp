@@ -0,0 +1,53 @@
+#ifndef MOD_LIB_GRAPH_INVARIANTS_H
+#define MOD_LIB_GRAPH_INVARIANTS_H
+
+#include <mod/Config.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace mod {
+namespace lib {
+namespace Graph {
+struct Single;
+
+// A hash of the graph which is invariant under isomorphism with the given label type.
+// It combines the vertex labels, the degree sequence,
+// and the vertex colours after a few rounds of Weisfeiler-Lehman refinement.
+// Labels are only used with LabelType::String, as differently named terms may still be isomorphic.
+std::size_t getInvariantHash(const Single &g, LabelType labelType);
+// A hash of the stereo information which is invariant under isomorphism with the isomorphism stereo relation.
+// It combines the multiset of vertex labels (with LabelType::String) paired with their geometry.
+std::size_t getStereoInvariantHash(const Single &g, LabelType labelType);
+
+// Invariants of a graph which are cheap to compare, for rejecting isomorphism and monomorphism
+// before running VF2. The labels are given by their ids in getLabelStrings().
+struct GraphInvariants {
+	// a hash of the multisets of vertex and edge labels
+	std::size_t labelHash;
+	// a hash of the degree histogram, and one of the degree profiles and edge label counts
+	std::size_t degreeHash, profileHash;
+	// all vertex degrees, in descending order
+	std::vector<unsigned int> degrees;
+	// for each vertex label, the degrees of the vertices with that label, in descending order,
+	// sorted by label
+	std::vector<std::pair<std::size_t, std::vector<unsigned int> > > labelDegrees;
+	// for each edge label, the number of edges with that label, sorted by label
+	std::vector<std::pair<std::size_t, unsigned int> > edgeLabelCounts;
+};
+
+GraphInvariants getInvariants(const Single &g);
+// False if the invariants show that the graphs are not isomorphic with the given label settings.
+// This is constant time.
+bool mayBeIsomorphic(const GraphInvariants &gDom, const GraphInvariants &gCodom, LabelSettings labelSettings);
+// False if the invariants show that there is no monomorphism from gDom to gCodom with the given label settings.
+// That is, if gDom has more vertices of some label and with at least some degree than gCodom,
+// or more edges with some label.
+bool mayBeMonomorphic(const GraphInvariants &gDom, const GraphInvariants &gCodom, LabelSettings labelSettings);
+
+} // namespace Graph
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_GRAPH_INVARIANTS_H */
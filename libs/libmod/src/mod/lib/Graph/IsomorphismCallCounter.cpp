@@ -0,0 +1,44 @@
+#include "IsomorphismCallCounter.hpp"
+
+#include <cassert>
+
+namespace mod {
+namespace lib {
+namespace Graph {
+namespace {
+thread_local IsomorphismCallCounter *current = nullptr;
+} // namespace
+
+IsomorphismCallCounter::IsomorphismCallCounter() : parent(current), count(0) {
+	current = this;
+}
+
+IsomorphismCallCounter::~IsomorphismCallCounter() {
+	assert(current == this);
+	current = parent;
+}
+
+unsigned long IsomorphismCallCounter::get() const {
+	return count.load(std::memory_order_relaxed);
+}
+
+void IsomorphismCallCounter::countCall() {
+	for(IsomorphismCallCounter *c = current; c; c = c->parent)
+		c->count.fetch_add(1, std::memory_order_relaxed);
+}
+
+IsomorphismCallCounter *IsomorphismCallCounter::getCurrent() {
+	return current;
+}
+
+IsomorphismCallCounter::Inherit::Inherit(IsomorphismCallCounter *counter) : prev(current) {
+	current = counter;
+}
+
+IsomorphismCallCounter::Inherit::~Inherit() {
+	current = prev;
+}
+
+} // namespace Graph
+} // namespace lib
+} // namespace mod
@@ -0,0 +1,44 @@
+#ifndef MOD_LIB_GRAPH_ISOMORPHISM_CALL_COUNTER_H
+#define MOD_LIB_GRAPH_ISOMORPHISM_CALL_COUNTER_H
+
+#include <atomic>
+
+namespace mod {
+namespace lib {
+namespace Graph {
+
+// Counts the graph isomorphism calls made while it is alive, by the thread that created it,
+// and by the tasks that thread runs with lib::parallelForEach.
+// Unlike config.graph.numIsomorphismCalls, calls from unrelated threads are not counted.
+// Counters may be nested, in which case a call is counted by all of them.
+struct IsomorphismCallCounter {
+	IsomorphismCallCounter();
+	IsomorphismCallCounter(const IsomorphismCallCounter &) = delete;
+	IsomorphismCallCounter &operator=(const IsomorphismCallCounter &) = delete;
+	~IsomorphismCallCounter();
+	unsigned long get() const;
+public:
+	// Counts a call in the counters of the calling thread.
+	static void countCall();
+	static IsomorphismCallCounter *getCurrent();
+
+	// Makes the given counter, which may be null, current in the calling thread while alive,
+	// e.g., for a task run on behalf of another thread.
+	struct Inherit {
+		explicit Inherit(IsomorphismCallCounter *counter);
+		Inherit(const Inherit &) = delete;
+		Inherit &operator=(const Inherit &) = delete;
+		~Inherit();
+	private:
+		IsomorphismCallCounter *const prev;
+	};
+private:
+	IsomorphismCallCounter *const parent;
+	std::atomic<unsigned long> count;
+};
+
+} // namespace Graph
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_GRAPH_ISOMORPHISM_CALL_COUNTER_H */
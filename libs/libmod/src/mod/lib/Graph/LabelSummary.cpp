@@ -0,0 +1,110 @@
+#include "LabelSummary.hpp"
+
+#include <mod/lib/Graph/Single.hpp>
+#include <mod/lib/Graph/Properties/String.hpp>
+#include <mod/lib/Rules/Real.hpp>
+
+#include <jla_boost/graph/PairToRangeAdaptor.hpp>
+
+#include <algorithm>
+#include <map>
+
+namespace mod {
+namespace lib {
+namespace Graph {
+namespace {
+
+LabelSummary::Counts toCounts(const std::map<std::string, unsigned int> &m) {
+	return LabelSummary::Counts(m.begin(), m.end());
+}
+
+bool countsContain(const LabelSummary::Counts &host, const LabelSummary::Counts &pattern) {
+	// both are sorted, so a single merge-like scan suffices
+	auto iterHost = host.begin();
+	for(const auto &p : pattern) {
+		iterHost = std::lower_bound(iterHost, host.end(), p.first, [](const auto &a, const std::string &b) {
+			return a.first < b;
+		});
+		if(iterHost == host.end() || iterHost->first != p.first || iterHost->second < p.second)
+			return false;
+	}
+	return true;
+}
+
+unsigned int getCount(const LabelSummary::Counts &counts, const std::string &label) {
+	const auto iter = std::lower_bound(counts.begin(), counts.end(), label, [](const auto &a, const std::string &b) {
+		return a.first < b;
+	});
+	if(iter == counts.end() || iter->first != label) return 0;
+	return iter->second;
+}
+
+template<typename G>
+LabelSummary makeSummary(const G &graph, const PropString &pString) {
+	std::map<std::string, unsigned int> vLabels, eLabels;
+	for(const auto v : asRange(vertices(graph)))
+		++vLabels[pString[v]];
+	for(const auto e : asRange(edges(graph)))
+		++eLabels[pString[e]];
+	LabelSummary res;
+	res.numVertices = num_vertices(graph);
+	res.numEdges = num_edges(graph);
+	res.vertexLabels = toCounts(vLabels);
+	res.edgeLabels = toCounts(eLabels);
+	return res;
+}
+
+} // namespace
+
+LabelSummary LabelSummary::make(const Single &g) {
+	return makeSummary(g.getGraph(), g.getStringState());
+}
+
+LabelSummary LabelSummary::make(const GraphType &g, const PropString &pString) {
+	return makeSummary(g, pString);
+}
+
+bool LabelSummary::mayContain(const LabelSummary &pattern) const {
+	return numVertices >= pattern.numVertices
+	       && numEdges >= pattern.numEdges
+	       && countsContain(vertexLabels, pattern.vertexLabels)
+	       && countsContain(edgeLabels, pattern.edgeLabels);
+}
+
+unsigned int LabelSummary::vertexLabelCount(const std::string &label) const {
+	return getCount(vertexLabels, label);
+}
+
+unsigned int LabelSummary::edgeLabelCount(const std::string &label) const {
+	return getCount(edgeLabels, label);
+}
+
+std::vector<LabelSummary> getLeftComponentSummaries(const Rules::Real &r) {
+	const auto &lr = r.getDPORule();
+	const auto lgLeft = get_labelled_left(lr);
+	const auto pString = get_string(lgLeft);
+	const auto numComponents = get_num_connected_components(lgLeft);
+	std::vector<LabelSummary> res;
+	res.reserve(numComponents);
+	for(std::size_t i = 0; i != numComponents; ++i) {
+		const auto gComp = get_component_graph(i, lgLeft);
+		std::map<std::string, unsigned int> vLabels, eLabels;
+		LabelSummary s;
+		for(const auto v : asRange(vertices(gComp))) {
+			++s.numVertices;
+			++vLabels[pString[v]];
+		}
+		for(const auto e : asRange(edges(gComp))) {
+			++s.numEdges;
+			++eLabels[pString[e]];
+		}
+		s.vertexLabels = toCounts(vLabels);
+		s.edgeLabels = toCounts(eLabels);
+		res.push_back(std::move(s));
+	}
+	return res;
+}
+
+} // namespace Graph
+} // namespace lib
+} // namespace mod
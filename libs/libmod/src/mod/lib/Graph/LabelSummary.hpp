@@ -0,0 +1,46 @@
+#ifndef MOD_LIB_GRAPH_LABELSUMMARY_H
+#define MOD_LIB_GRAPH_LABELSUMMARY_H
+
+#include <mod/lib/Graph/GraphDecl.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mod {
+namespace lib {
+namespace Rules {
+struct Real;
+} // namespace Rules
+namespace Graph {
+struct PropString;
+struct Single;
+
+// A small summary of a labelled graph: its size and the multisets of vertex and edge labels.
+// With LabelType::String a graph can only contain a (connected) pattern if it has at least as many
+// vertices and edges, and at least as many occurrences of each label.
+struct LabelSummary {
+	// sorted by label
+	using Counts = std::vector<std::pair<std::string, unsigned int> >;
+public:
+	static LabelSummary make(const Single &g);
+	// For a graph which has only been parsed, without creating a Single.
+	static LabelSummary make(const GraphType &g, const PropString &pString);
+	// A necessary condition for a monomorphism from pattern into this graph, with LabelType::String.
+	bool mayContain(const LabelSummary &pattern) const;
+	unsigned int vertexLabelCount(const std::string &label) const;
+	unsigned int edgeLabelCount(const std::string &label) const;
+public:
+	std::size_t numVertices = 0, numEdges = 0;
+	Counts vertexLabels, edgeLabels;
+};
+
+// The summaries of each connected component of the left side of the rule.
+std::vector<LabelSummary> getLeftComponentSummaries(const Rules::Real &r);
+
+} // namespace Graph
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_GRAPH_LABELSUMMARY_H */
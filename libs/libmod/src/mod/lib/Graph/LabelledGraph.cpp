@@ -18,8 +18,13 @@ LabelledGraph::LabelledGraph(std::unique_ptr<GraphType> g, std::unique_ptr<PropS
 : g(std::move(g)), pString(std::move(pString)), pStereo(std::move(pStereo)) {
 	assert(this->g);
 	assert(this->pString);
+	this->g->freeze();
 	this->pString->verify(this->g.get());
-	if(this->pStereo) this->pStereo->verify(this->g.get());
+	if(this->pStereo) {
+		this->pStereo->verify(this->g.get());
+		// it is given, so it should not be inferred
+		stereoFlag.callOnce([] {});
+	}
 }
 
 LabelledGraph::LabelledGraph(const LabelledGraph &other) {
@@ -51,23 +56,25 @@ const LabelledGraph::PropStringType &get_string(const LabelledGraph &g) {
 }
 
 LabelledGraph::PropTermType &get_term(LabelledGraph &g) {
-	assert(g.pString || g.pTerm);
-	if(!g.pTerm) g.pTerm.reset(new LabelledGraph::PropTermType(get_graph(g), get_string(g), lib::Term::getStrings()));
+	const auto &gConst = g;
+	get_term(gConst);
 	return *g.pTerm;
 }
 
 const LabelledGraph::PropTermType &get_term(const LabelledGraph &g) {
 	assert(g.pString || g.pTerm);
-	if(!g.pTerm) g.pTerm.reset(new LabelledGraph::PropTermType(get_graph(g), get_string(g), lib::Term::getStrings()));
+	g.termFlag.callOnce([&g]() {
+		if(!g.pTerm) g.pTerm.reset(new LabelledGraph::PropTermType(get_graph(g), get_string(g), lib::Term::getStrings()));
+	});
 	return *g.pTerm;
 }
 
 bool has_stereo(const LabelledGraph &g) {
-	return bool(g.pStereo);
+	return g.stereoFlag.isDone();
 }
 
 const LabelledGraph::PropStereoType &get_stereo(const LabelledGraph &g) {
-	if(!has_stereo(g)) {
+	g.stereoFlag.callOnce([&g]() {
 		auto inference = lib::Stereo::makeInference(get_graph(g), get_molecule(g), false);
 		std::stringstream ssErr;
 		auto result = inference.finalize(ssErr, [&g](Vertex v) {
@@ -83,23 +90,22 @@ const LabelledGraph::PropStereoType &get_stereo(const LabelledGraph &g) {
 			throw StereoDeductionError(ssErr.str());
 		}
 		g.pStereo.reset(new PropStereo(get_graph(g), std::move(inference)));
-	}
+	});
 	return *g.pStereo;
 }
 
 const LabelledGraph::PropMoleculeType &get_molecule(const LabelledGraph &g) {
-	// this makes some GCC versions generate better code than having the unlikely branch in the if
-	if(g.pMolecule)
-		return *g.pMolecule;
-	g.pMolecule.reset(new LabelledGraph::PropMoleculeType(get_graph(g), get_string(g)));
+	g.moleculeFlag.callOnce([&g]() {
+		g.pMolecule.reset(new LabelledGraph::PropMoleculeType(get_graph(g), get_string(g)));
+	});
 	return *g.pMolecule;
 }
 
 const std::vector<typename boost::graph_traits<GraphType>::vertex_descriptor>&
 get_vertex_order(const LabelledGraph &g) {
-	if(g.vertex_order.empty()) {
+	g.vertexOrderFlag.callOnce([&g]() {
 		g.vertex_order = get_vertex_order(mod::lib::GraphMorphism::DefaultFinderArgsProvider(), get_graph(g));
-	}
+	});
 	return g.vertex_order;
 }
 
@@ -2,6 +2,7 @@
 #define MOD_LIB_GRAPH_LABELLED_GRAPH_H
 
 #include <mod/lib/Graph/GraphDecl.hpp>
+#include <mod/lib/OnceFlag.hpp>
 
 namespace mod {
 namespace lib {
@@ -43,6 +44,8 @@ private: // views
 	mutable std::unique_ptr<PropMoleculeType> pMolecule;
 private: // optimisation
 	mutable std::vector<typename boost::graph_traits<GraphType>::vertex_descriptor> vertex_order;
+private: // for concurrent initialisation of the lazily computed members
+	mutable OnceFlag termFlag, stereoFlag, moleculeFlag, vertexOrderFlag;
 };
 
 } // namespace Graph
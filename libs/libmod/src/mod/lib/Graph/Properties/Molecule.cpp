@@ -8,6 +8,8 @@
 
 #include <jla_boost/graph/PairToRangeAdaptor.hpp>
 
+#include <numeric>
+
 namespace mod {
 namespace lib {
 namespace Graph {
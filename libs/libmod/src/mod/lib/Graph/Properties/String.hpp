@@ -2,13 +2,18 @@
 #define MOD_LIB_GRAPH_PROP_LABEL_H
 
 #include <mod/lib/Graph/Properties/Property.hpp>
+#include <mod/lib/StringStore.hpp>
+
+#include <string>
 
 namespace mod {
 namespace lib {
 namespace Graph {
 
-struct PropString : Prop<PropString, std::string, std::string> {
-	using Base = Prop<PropString, std::string, std::string>;
+// The labels are stored as their indices in getLabelStrings(),
+// so they can be compared through getId instead of as strings.
+struct PropString : Prop<PropString, std::size_t, std::size_t> {
+	using Base = Prop<PropString, std::size_t, std::size_t>;
 public:
 
 	explicit PropString(const GraphType &g) : Base(g) {
@@ -18,8 +23,48 @@ public:
 	PropString(const PropString &other, const GraphType &g) : Base(other, g) {
 		Base::verify(&g);
 	}
+
+	void addVertex(Vertex v, const std::string &label) {
+		Base::addVertex(v, getLabelStrings().getIndex(label));
+	}
+
+	void addEdge(Edge e, const std::string &label) {
+		Base::addEdge(e, getLabelStrings().getIndex(label));
+	}
+
+	const std::string &operator[](Vertex v) const {
+		return getLabelStrings().getString(getId(v));
+	}
+
+	const std::string &operator[](Edge e) const {
+		return getLabelStrings().getString(getId(e));
+	}
+
+	std::size_t getId(Vertex v) const {
+		return Base::operator[](v);
+	}
+
+	std::size_t getId(Edge e) const {
+		return Base::operator[](e);
+	}
 };
 
+inline const std::string &get(const PropString &p, PropString::Vertex v) {
+	return p[v];
+}
+
+inline const std::string &get(const PropString &p, PropString::Edge e) {
+	return p[e];
+}
+
+inline std::size_t get_label_id(const PropString &p, PropString::Vertex v) {
+	return p.getId(v);
+}
+
+inline std::size_t get_label_id(const PropString &p, PropString::Edge e) {
+	return p.getId(e);
+}
+
 } // namespace Graph
 } // namespace lib
 } // namespace mod
@@ -8,6 +8,8 @@
 #include <mod/lib/Chem/Smiles.hpp>
 #include <mod/lib/Graph/Canonicalisation.hpp>
 #include <mod/lib/Graph/DFSEncoding.hpp>
+#include <mod/lib/Graph/Invariants.hpp>
+#include <mod/lib/Graph/IsomorphismCallCounter.hpp>
 #include <mod/lib/Graph/Properties/Depiction.hpp>
 #include <mod/lib/Graph/Properties/Molecule.hpp>
 #include <mod/lib/Graph/Properties/Stereo.hpp>
@@ -19,9 +21,11 @@
 #include <mod/lib/IO/Graph.hpp>
 #include <mod/lib/LabelledGraph.hpp>
 #include <mod/lib/Random.hpp>
+#include <mod/lib/RC/ComposeRuleReal.hpp>
 #include <mod/lib/Rules/GraphToRule.hpp>
 #include <mod/lib/Rules/Real.hpp>
 #include <mod/lib/Term/WAM.hpp>
+#include <mod/lib/ThreadPool.hpp>
 
 #include <jla_boost/graph/morphism/callbacks/Limit.hpp>
 
@@ -29,13 +33,16 @@
 #include <boost/graph/graph_traits.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <atomic>
+
 namespace mod {
 namespace lib {
 namespace Graph {
 BOOST_CONCEPT_ASSERT((LabelledGraphConcept<LabelledGraph>));
 
 namespace {
-std::size_t nextGraphNum = 0;
+// atomic as graphs may be created concurrently, e.g., by derivation graph builds in different threads
+std::atomic<std::size_t> nextGraphNum(0);
 
 const std::string getGraphName(unsigned int id) {
 	return "g_{" + boost::lexical_cast<std::string>(id) + "}";
@@ -90,6 +97,8 @@ id(nextGraphNum++), name(getGraphName(id)) {
 	}
 }
 
+Single::Single(Single &&) = default;
+
 Single::~Single() { }
 
 const LabelledGraph &Single::getLabelledGraph() const {
@@ -120,25 +129,29 @@ void Single::setName(std::string name) {
 }
 
 const std::pair<const std::string&, bool> Single::getGraphDFS() const {
-	if(!dfs) std::tie(dfs, dfsHasNonSmilesRingClosure) = DFSEncoding::write(getGraph(), getStringState(), false);
+	dfsFlag.callOnce([this]() {
+		std::tie(dfs, dfsHasNonSmilesRingClosure) = DFSEncoding::write(getGraph(), getStringState(), false);
+	});
 	return std::pair<const std::string&, bool>(*dfs, dfsHasNonSmilesRingClosure);
 }
 
 const std::string &Single::getGraphDFSWithIds() const {
-	if(!dfsWithIds) dfsWithIds = DFSEncoding::write(getGraph(), getStringState(), true).first;
+	dfsWithIdsFlag.callOnce([this]() {
+		dfsWithIds = DFSEncoding::write(getGraph(), getStringState(), true).first;
+	});
 	return *dfsWithIds;
 }
 
 const std::string &Single::getSmiles() const {
 	if(getMoleculeState().getIsMolecule()) {
-		if(!smiles) {
+		smilesFlag.callOnce([this]() {
 			if(getConfig().graph.useWrongSmilesCanonAlg.get()) {
 				smiles.reset(Chem::getSmiles(getGraph(), getMoleculeState(), nullptr, false));
 			} else {
 				getCanonForm(LabelType::String, false); // TODO: make the withStereo a parameter
 				smiles.reset(Chem::getSmiles(getGraph(), getMoleculeState(), &canon_perm_string, false));
 			}
-		}
+		});
 		return *smiles;
 	} else {
 		std::string text;
@@ -150,14 +163,14 @@ const std::string &Single::getSmiles() const {
 
 const std::string &Single::getSmilesWithIds() const {
 	if(getMoleculeState().getIsMolecule()) {
-		if(!smilesWithIds) {
+		smilesWithIdsFlag.callOnce([this]() {
 			if(getConfig().graph.useWrongSmilesCanonAlg.get()) {
 				smilesWithIds.reset(Chem::getSmiles(getGraph(), getMoleculeState(), nullptr, true));
 			} else {
 				getCanonForm(LabelType::String, false); // TODO: make the withStereo a parameter
 				smilesWithIds.reset(Chem::getSmiles(getGraph(), getMoleculeState(), &canon_perm_string, true));
 			}
-		}
+		});
 		return *smilesWithIds;
 	} else {
 		std::string text;
@@ -168,17 +181,23 @@ const std::string &Single::getSmilesWithIds() const {
 }
 
 std::shared_ptr<rule::Rule> Single::getBindRule() const {
-	if(!bindRule) bindRule = rule::Rule::makeRule(lib::Rules::graphToRule(g, lib::Rules::Membership::Right, getName()));
+	bindRuleFlag.callOnce([this]() {
+		bindRule = rule::Rule::makeRule(lib::Rules::graphToRule(g, lib::Rules::Membership::Right, getName()));
+	});
 	return bindRule;
 }
 
 std::shared_ptr<rule::Rule> Single::getIdRule() const {
-	if(!idRule) idRule = rule::Rule::makeRule(lib::Rules::graphToRule(g, lib::Rules::Membership::Context, getName()));
+	idRuleFlag.callOnce([this]() {
+		idRule = rule::Rule::makeRule(lib::Rules::graphToRule(g, lib::Rules::Membership::Context, getName()));
+	});
 	return idRule;
 }
 
 std::shared_ptr<rule::Rule> Single::getUnbindRule() const {
-	if(!unbindRule) unbindRule = rule::Rule::makeRule(lib::Rules::graphToRule(g, lib::Rules::Membership::Left, getName()));
+	unbindRuleFlag.callOnce([this]() {
+		unbindRule = rule::Rule::makeRule(lib::Rules::graphToRule(g, lib::Rules::Membership::Left, getName()));
+	});
 	return unbindRule;
 }
 
@@ -203,12 +222,16 @@ unsigned int Single::getEdgeLabelCount(const std::string &label) const {
 }
 
 DepictionData &Single::getDepictionData() {
-	if(!depictionData) depictionData.reset(new DepictionData(getLabelledGraph()));
+	depictionDataFlag.callOnce([this]() {
+		depictionData.reset(new DepictionData(getLabelledGraph()));
+	});
 	return *depictionData;
 }
 
 const DepictionData &Single::getDepictionData() const {
-	if(!depictionData) depictionData.reset(new DepictionData(getLabelledGraph()));
+	depictionDataFlag.callOnce([this]() {
+		depictionData.reset(new DepictionData(getLabelledGraph()));
+	});
 	return *depictionData;
 }
 
@@ -233,10 +256,10 @@ const Single::CanonForm &Single::getCanonForm(LabelType labelType, bool withSter
 	// TODO: when Terms are supported, remember to check if the state is valid, else throw TermParsingError
 	if(withStereo)
 		throw LogicError("Can not canonicalise stereo.");
-	if(!canon_form_string) {
+	canonFlag.callOnce([&]() {
 		assert(!aut_group_string);
 		std::tie(canon_perm_string, canon_form_string, aut_group_string) = lib::Graph::getCanonForm(*this, labelType, withStereo);
-	}
+	});
 	assert(canon_form_string);
 	assert(aut_group_string);
 	return *canon_form_string;
@@ -248,6 +271,31 @@ const Single::AutGroup &Single::getAutGroup(LabelType labelType, bool withStereo
 	return *aut_group_string;
 }
 
+const Single::AutPerms &Single::getAutPerms(LabelType labelType, bool withStereo) const {
+	const auto &group = getAutGroup(labelType, withStereo);
+	autPermsFlag.callOnce([&]() {
+		// bounds the cost of testing a vertex mapping against all the permutations
+		constexpr std::size_t maxPerms = 128;
+		aut_perms_string = std::make_unique<const AutPerms>(lib::Graph::getAutPerms(*this, group, maxPerms));
+	});
+	return *aut_perms_string;
+}
+
+std::size_t Single::getCanonHash(LabelType labelType, bool withStereo) const {
+	getCanonForm(labelType, withStereo);
+	canonHashFlag.callOnce([this]() {
+		canon_hash_string = lib::Graph::getCanonHash(*this, canon_perm_string);
+	});
+	return *canon_hash_string;
+}
+
+const GraphInvariants &Single::getInvariants() const {
+	invariantsFlag.callOnce([this]() {
+		invariants = std::make_unique<const GraphInvariants>(lib::Graph::getInvariants(*this));
+	});
+	return *invariants;
+}
+
 //------------------------------------------------------------------------------
 // Static
 //------------------------------------------------------------------------------
@@ -256,6 +304,11 @@ namespace {
 namespace GM = jla_boost::GraphMorphism;
 namespace GM_MOD = lib::GraphMorphism;
 
+void countIsomorphismCall() {
+	getConfig().graph.numIsomorphismCalls.increment();
+	IsomorphismCallCounter::countCall();
+}
+
 template<typename Finder>
 std::size_t morphism(const Single &gDomain, const Single &gCodomain, std::size_t maxNumMatches, LabelSettings labelSettings, Finder finder) {
 	auto mr = GM::makeLimit(maxNumMatches);
@@ -267,8 +320,12 @@ std::size_t isomorphismSmilesOrCanonOrVF2(const Single &gDom, const Single &gCod
 	const auto &ggDom = gDom.getLabelledGraph();
 	const auto &ggCodom = gCodom.getLabelledGraph();
 	// first try if we can compare canonical SMILES strings
-	if(get_molecule(ggDom).getIsMolecule() && get_molecule(ggCodom).getIsMolecule() && !getConfig().graph.useWrongSmilesCanonAlg.get())
-		return gDom.getSmiles() == gCodom.getSmiles() ? 1 : 0;
+	// the SMILES strings do not include stereo information, so with stereo they can only rule out isomorphism
+	if(get_molecule(ggDom).getIsMolecule() && get_molecule(ggCodom).getIsMolecule() && !getConfig().graph.useWrongSmilesCanonAlg.get()) {
+		if(gDom.getSmiles() != gCodom.getSmiles()) return 0;
+		if(!labelSettings.withStereo) return 1;
+		return Single::isomorphismVF2(gDom, gCodom, 1, labelSettings);
+	}
 
 	// otherwise maybe we can still do canonical form comparison
 	if(labelSettings.type == LabelType::String && !labelSettings.withStereo) {
@@ -279,14 +336,34 @@ std::size_t isomorphismSmilesOrCanonOrVF2(const Single &gDom, const Single &gCod
 	return Single::isomorphismVF2(gDom, gCodom, 1, labelSettings);
 }
 
+bool isomorphismCanonOrVF2(const Single &gDom, const Single &gCodom, LabelSettings labelSettings) {
+	// the canonical form only covers string labels with the isomorphism relation,
+	// and only the underlying graph, not the stereo information
+	const bool canUseCanon = labelSettings.type == LabelType::String
+			&& labelSettings.relation == LabelRelation::Isomorphism
+			&& canCanonicalise(gDom, labelSettings.type, false)
+			&& canCanonicalise(gCodom, labelSettings.type, false);
+	if(!canUseCanon)
+		return Single::isomorphismVF2(gDom, gCodom, 1, labelSettings) == 1;
+	if(!canonicalCompare(gDom, gCodom, labelSettings.type, false)) return false;
+	if(!labelSettings.withStereo) return true;
+	// the underlying graphs are isomorphic, so let VF2 settle the stereo information
+	return Single::isomorphismVF2(gDom, gCodom, 1, labelSettings) == 1;
+}
+
 } // namespace
 
 std::size_t Single::isomorphismVF2(const Single &gDom, const Single &gCodom, std::size_t maxNumMatches, LabelSettings labelSettings) {
+	getConfig().graph.numVF2Calls.increment();
 	return morphism(gDom, gCodom, maxNumMatches, labelSettings, GM_MOD::VF2Isomorphism());
 }
 
 bool Single::isomorphic(const Single &gDom, const Single &gCodom, LabelSettings labelSettings) {
-	++getConfig().graph.numIsomorphismCalls();
+	return isomorphic(gDom, gCodom, labelSettings, getConfig().graph.isomorphismAlg.get());
+}
+
+bool Single::isomorphic(const Single &gDom, const Single &gCodom, LabelSettings labelSettings, Config::IsomorphismAlg alg) {
+	countIsomorphismCall();
 	const auto nDom = num_vertices(gDom.getGraph());
 	const auto nCodom = num_vertices(gCodom.getGraph());
 	if(nDom != nCodom) return false; // early bail-out
@@ -295,23 +372,23 @@ bool Single::isomorphic(const Single &gDom, const Single &gCodom, LabelSettings
 	if(nDom == 0)
 		return gDom.getName() == gCodom.getName();
 	if(&gDom == &gCodom) return true;
-	switch(getConfig().graph.isomorphismAlg.get()) {
+	if(!mayBeIsomorphic(gDom.getInvariants(), gCodom.getInvariants(), labelSettings)) {
+		getConfig().graph.numInvariantRejects.increment();
+		return false;
+	}
+	switch(alg) {
 	case Config::IsomorphismAlg::SmilesCanonVF2:
 		return isomorphismSmilesOrCanonOrVF2(gDom, gCodom, labelSettings);
 	case Config::IsomorphismAlg::VF2:
 		return isomorphismVF2(gDom, gCodom, 1, labelSettings);
 	case Config::IsomorphismAlg::Canon:
-		if(labelSettings.relation != LabelRelation::Isomorphism)
-			throw LogicError("Can only do isomorphism via canonicalisation with the isomorphism relation.");
-		if(labelSettings.withStereo && labelSettings.stereoRelation != LabelRelation::Isomorphism)
-			throw LogicError("Can only do isomorphism via canonicalisation with the isomorphism stereo relation.");
-		return canonicalCompare(gDom, gCodom, labelSettings.type, labelSettings.withStereo);
+		return isomorphismCanonOrVF2(gDom, gCodom, labelSettings);
 	}
 	MOD_ABORT;
 }
 
 std::size_t Single::isomorphism(const Single &gDom, const Single &gCodom, std::size_t maxNumMatches, LabelSettings labelSettings) {
-	++getConfig().graph.numIsomorphismCalls();
+	countIsomorphismCall();
 	if(maxNumMatches == 1)
 		return isomorphic(gDom, gCodom, labelSettings) ? 1 : 0;
 	// this hax with name comparing is basically to make abstract derivation graphs
@@ -320,11 +397,20 @@ std::size_t Single::isomorphism(const Single &gDom, const Single &gCodom, std::s
 	const auto nCodom = num_vertices(gCodom.getGraph());
 	if(nDom == 0 && nCodom == 0)
 		return gDom.getName() == gCodom.getName() ? 1 : 0;
+	if(nDom != nCodom || !mayBeIsomorphic(gDom.getInvariants(), gCodom.getInvariants(), labelSettings)) {
+		getConfig().graph.numInvariantRejects.increment();
+		return 0;
+	}
 	// we only have VF2 for doing multiple morphisms
 	return isomorphismVF2(gDom, gCodom, maxNumMatches, labelSettings);
 }
 
 std::size_t Single::monomorphism(const Single &gDom, const Single &gCodom, std::size_t maxNumMatches, LabelSettings labelSettings) {
+	if(!mayBeMonomorphic(gDom.getInvariants(), gCodom.getInvariants(), labelSettings)) {
+		getConfig().graph.numInvariantRejects.increment();
+		return 0;
+	}
+	getConfig().graph.numVF2Calls.increment();
 	return morphism(gDom, gCodom, maxNumMatches, labelSettings, GM_MOD::VF2Monomorphism());
 }
 
@@ -372,6 +458,51 @@ Single makePermutation(const Single &g) {
 	return gPerm;
 }
 
+void precompute(const std::vector<const Single *> &graphs, LabelSettings labelSettings) {
+	const auto alg = getConfig().graph.isomorphismAlg.get();
+	lib::parallelForEach(graphs.size(), [&](std::size_t i) {
+		const Single &g = *graphs[i];
+		const auto &lg = g.getLabelledGraph();
+		get_molecule(lg);
+		get_vertex_order(lg);
+		if(labelSettings.type == LabelType::Term) get_term(lg);
+		if(labelSettings.withStereo) get_stereo(lg);
+		g.getInvariants();
+		if(alg == Config::IsomorphismAlg::Canon && num_vertices(g.getGraph()) != 0
+		   && canCanonicalise(g, labelSettings.type, false))
+			g.getCanonHash(labelSettings.type, false);
+		if(alg == Config::IsomorphismAlg::SmilesCanonVF2 && get_molecule(lg).getIsMolecule())
+			g.getSmiles();
+		lib::RC::prepareForComposition(g.getBindRule()->getRule(), labelSettings);
+	});
+}
+
+void canonicalise(const std::vector<const Single *> &graphs) {
+	lib::parallelForEach(graphs.size(), [&](std::size_t i) {
+		const Single &g = *graphs[i];
+		if(num_vertices(g.getGraph()) != 0 && canCanonicalise(g, LabelType::String, false))
+			g.getCanonHash(LabelType::String, false);
+		if(g.getMoleculeState().getIsMolecule()) g.getSmiles();
+		g.getGraphDFS();
+	});
+}
+
+void canonicaliseForIsomorphism(const std::vector<const Single *> &graphs, LabelSettings labelSettings) {
+	if(labelSettings.type != LabelType::String) return;
+	const auto alg = getConfig().graph.isomorphismAlg.get();
+	const bool useCanon = alg == Config::IsomorphismAlg::Canon
+			&& labelSettings.relation == LabelRelation::Isomorphism;
+	const bool useSmiles = alg == Config::IsomorphismAlg::SmilesCanonVF2
+			&& !getConfig().graph.useWrongSmilesCanonAlg.get();
+	if(!useCanon && !useSmiles) return;
+	lib::parallelForEach(graphs.size(), [&](std::size_t i) {
+		const Single &g = *graphs[i];
+		if(useCanon && num_vertices(g.getGraph()) != 0 && canCanonicalise(g, LabelType::String, false))
+			g.getCanonHash(LabelType::String, false);
+		if(useSmiles && g.getMoleculeState().getIsMolecule()) g.getSmiles();
+	});
+}
+
 } // namespace Graph
 } // namespace lib
 } // namespace mod
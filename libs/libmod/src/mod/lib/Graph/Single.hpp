@@ -6,6 +6,7 @@
 #include <mod/rule/ForwardDecl.hpp>
 #include <mod/lib/Graph/GraphDecl.hpp>
 #include <mod/lib/Graph/LabelledGraph.hpp>
+#include <mod/lib/OnceFlag.hpp>
 
 #include <graph_canon/ordered_graph.hpp>
 
@@ -23,18 +24,20 @@ namespace lib {
 namespace Graph {
 struct PropMolecule;
 struct DepictionData;
+struct GraphInvariants;
 
 struct Single {
 	using CanonIdxMap = boost::iterator_property_map<std::vector<int>::const_iterator,
 					decltype(get(boost::vertex_index_t(), GraphType()))>;
 	using CanonForm = graph_canon::ordered_graph<GraphType, CanonIdxMap>;
 	using AutGroup = perm_group::generated_group<perm_group::raw_ptr_allocator<std::vector<int> > >;
+	using AutPerms = std::vector<std::vector<std::size_t> >;
 public:
 	// requires g != nullptr, pString != nullptr
 	// pStereo may be null
 	Single(std::unique_ptr<GraphType> g, std::unique_ptr<PropString> pString, std::unique_ptr<PropStereo> pStereo);
 public:
-	Single(Single &&) = default;
+	Single(Single &&);
 	~Single();
 	const LabelledGraph &getLabelledGraph() const;
 	std::size_t getId() const;
@@ -60,6 +63,13 @@ public: // deprecated interface
 public:
 	const CanonForm &getCanonForm(LabelType labelType, bool withStereo) const;
 	const AutGroup &getAutGroup(LabelType labelType, bool withStereo) const;
+	// elements of getAutGroup as vertex index permutations, without the identity,
+	// truncated to a bounded number with the short products of the generators first
+	const AutPerms &getAutPerms(LabelType labelType, bool withStereo) const;
+	// a hash of the canonical form, see getCanonForm for the requirements
+	std::size_t getCanonHash(LabelType labelType, bool withStereo) const;
+	// used for rejecting isomorphism and monomorphism before running VF2
+	const GraphInvariants &getInvariants() const;
 private:
 	LabelledGraph g;
 	const std::size_t id;
@@ -73,10 +83,19 @@ private:
 	mutable std::vector<int> canon_perm_string;
 	mutable std::unique_ptr<const CanonForm> canon_form_string;
 	mutable std::unique_ptr<const AutGroup> aut_group_string;
+	mutable std::unique_ptr<const AutPerms> aut_perms_string;
+	mutable boost::optional<std::size_t> canon_hash_string;
+	mutable std::unique_ptr<const GraphInvariants> invariants;
 	mutable std::unique_ptr<DepictionData> depictionData;
+	// the lazily computed members above are initialised through these, so they can be accessed concurrently
+	mutable OnceFlag dfsFlag, dfsWithIdsFlag, smilesFlag, smilesWithIdsFlag;
+	mutable OnceFlag bindRuleFlag, idRuleFlag, unbindRuleFlag;
+	mutable OnceFlag canonFlag, canonHashFlag, autPermsFlag, invariantsFlag, depictionDataFlag;
 public:
 	static std::size_t isomorphismVF2(const Single &gDom, const Single &gCodom, std::size_t maxNumMatches, LabelSettings labelSettings);
 	static bool isomorphic(const Single &gDom, const Single &gCodom, LabelSettings labelSettings);
+	// as above, but with the given algorithm instead of the one from getConfig().graph.isomorphismAlg
+	static bool isomorphic(const Single &gDom, const Single &gCodom, LabelSettings labelSettings, Config::IsomorphismAlg alg);
 	static std::size_t isomorphism(const Single &gDom, const Single &gCodom, std::size_t maxNumMatches, LabelSettings labelSettings);
 	static std::size_t monomorphism(const Single &gDom, const Single &gCodom, std::size_t maxNumMatches, LabelSettings labelSettings);
 	static bool nameLess(const Single *g1, const Single *g2);
@@ -93,6 +112,18 @@ public:
 
 Single makePermutation(const Single &g);
 
+// Computes the lazily initialised data of the graphs which is used for rule application and isomorphism checks
+// under the given label settings, distributed over the library thread pool.
+// The data is computed on demand anyway, but doing it in bulk before a build uses all threads.
+void precompute(const std::vector<const Single *> &graphs, LabelSettings labelSettings);
+// Computes the canonical forms (when possible), the canonical SMILES strings (for molecules),
+// and the GraphDFS strings of the graphs, distributed over the library thread pool.
+void canonicalise(const std::vector<const Single *> &graphs);
+// Computes only the canonical data which the configured isomorphism algorithm uses for string labels,
+// i.e., the canonical forms with Config::IsomorphismAlg::Canon and the canonical SMILES strings
+// with Config::IsomorphismAlg::SmilesCanonVF2. Nothing is computed for other label settings.
+void canonicaliseForIsomorphism(const std::vector<const Single *> &graphs, LabelSettings labelSettings);
+
 namespace detail {
 
 struct IsomorphismPredicate {
@@ -3,6 +3,11 @@
 
 #include <mod/lib/GraphMorphism/Constraints/AllVisitor.hpp>
 
+#include <jla_boost/graph/morphism/Predicates.hpp>
+
+#include <memory>
+#include <vector>
+
 namespace mod {
 namespace lib {
 namespace GraphMorphism {
@@ -10,9 +15,12 @@ namespace Constraints {
 
 template<typename GraphDom, typename LabelledGraphCodom, typename Morphism>
 struct CheckVisitor : AllVisitor<GraphDom> {
+	using GraphCodom = typename LabelledGraphTraits<LabelledGraphCodom>::GraphType;
+public:
 
-	CheckVisitor(const GraphDom &gDom, const LabelledGraphCodom &lgCodom, Morphism &m, const LabelSettings ls)
-	: gDom(gDom), lgCodom(lgCodom), m(m), ls(ls) { }
+	CheckVisitor(const GraphDom &gDom, const LabelledGraphCodom &lgCodom, Morphism &m, const LabelSettings ls,
+			DistanceCache<GraphCodom> &distances)
+	: gDom(gDom), lgCodom(lgCodom), m(m), ls(ls), distances(distances) { }
 
 	virtual void operator()(const VertexAdjacency<GraphDom> &c) override {
 		result = c.matches(*this, gDom, lgCodom, m, ls);
@@ -26,19 +34,23 @@ public:
 	const LabelledGraphCodom &lgCodom;
 	Morphism &m;
 	const LabelSettings ls;
+	DistanceCache<GraphCodom> &distances;
 	bool result;
 };
 
 template<typename ConstraintRange, typename LabelledGraphCodom, typename Next>
 struct Checker {
+	using GraphCodom = typename LabelledGraphTraits<LabelledGraphCodom>::GraphType;
+public:
 
-	Checker(ConstraintRange constraints, const LabelledGraphCodom &lgCodom, LabelSettings ls, Next next)
-	: constraints(constraints), lgCodom(lgCodom), ls(ls), next(next) { }
+	Checker(ConstraintRange constraints, const LabelledGraphCodom &lgCodom, LabelSettings ls,
+			std::shared_ptr<DistanceCache<GraphCodom> > distances, Next next)
+	: constraints(constraints), lgCodom(lgCodom), ls(ls), distances(distances), next(next) { }
 
-	template<typename Morphism, typename GraphDom, typename GraphCodom>
-	bool operator()(Morphism &&m, const GraphDom &gDom, const GraphCodom &gCodom) const {
+	template<typename Morphism, typename GraphDom, typename GraphCodomU>
+	bool operator()(Morphism &&m, const GraphDom &gDom, const GraphCodomU &gCodom) const {
 		assert(&gCodom == &get_graph(lgCodom));
-		CheckVisitor<GraphDom, LabelledGraphCodom, Morphism> visitor(gDom, lgCodom, m, ls);
+		CheckVisitor<GraphDom, LabelledGraphCodom, Morphism> visitor(gDom, lgCodom, m, ls, *distances);
 		for(const auto &c : constraints) {
 			c->accept(visitor);
 			if(!visitor.result) return true;
@@ -49,13 +61,151 @@ private:
 	ConstraintRange constraints;
 	const LabelledGraphCodom &lgCodom;
 	LabelSettings ls;
+	std::shared_ptr<DistanceCache<GraphCodom> > distances;
 	Next next;
 };
 
+// The distances may be shared with other checkers for the same codomain.
 template<typename ConstraintRange, typename LabelledGraphCodom, typename Next = jla_boost::AlwaysTrue>
 Checker<ConstraintRange, LabelledGraphCodom, Next>
-makeChecker(ConstraintRange constraints, const LabelledGraphCodom &lgCodom, LabelSettings ls, Next next = jla_boost::AlwaysTrue()) {
-	return Checker<ConstraintRange, LabelledGraphCodom, Next>(constraints, lgCodom, ls, next);
+makeChecker(ConstraintRange constraints, const LabelledGraphCodom &lgCodom, LabelSettings ls,
+		std::shared_ptr<DistanceCache<typename LabelledGraphTraits<LabelledGraphCodom>::GraphType> > distances,
+		Next next = jla_boost::AlwaysTrue()) {
+	return Checker<ConstraintRange, LabelledGraphCodom, Next>(constraints, lgCodom, ls, distances, next);
+}
+
+// A vertex predicate which checks the constraints while the morphism is being extended,
+// as soon as the vertices a constraint depends on have been mapped (see jla_boost/graph/morphism/Predicates.hpp).
+// A constraint is only checked here if its outcome on the complete morphism is already determined,
+// while the rest are left to the Checker, which must therefore still be used.
+// The domain of the finder may be a subgraph of the graph of the constraints, e.g., a connected component,
+// but the vertex descriptors must be the same.
+template<typename GraphDom, typename LabelledGraphCodom, typename Next>
+struct PartialChecker {
+	using GraphCodom = typename LabelledGraphTraits<LabelledGraphCodom>::GraphType;
+	using Vertex = typename boost::graph_traits<GraphDom>::vertex_descriptor;
+public:
+
+	template<typename ConstraintRange, typename GraphFinderDom>
+	PartialChecker(ConstraintRange constraints, const GraphFinderDom &gFinderDom, const LabelledGraphCodom &lgCodom,
+			LabelSettings ls, std::shared_ptr<DistanceCache<GraphCodom> > distances, Next next)
+	: lgCodom(lgCodom), distances(distances), next(next) {
+		Collector<GraphFinderDom> collector(*this, gFinderDom, ls);
+		for(const auto &c : constraints)
+			c->accept(collector);
+	}
+
+	template<typename VEDom, typename VECodom, typename ...Args>
+	bool operator()(const VEDom &veDom, const VECodom &veCodom, Args&&... args) const {
+		return next(veDom, veCodom, std::forward<Args>(args)...);
+	}
+
+	template<typename VertexMap, typename GraphFinderDom, typename GraphFinderCodom>
+	bool partial(const typename boost::graph_traits<GraphFinderDom>::vertex_descriptor vDom,
+			const typename boost::graph_traits<GraphFinderCodom>::vertex_descriptor vCodom,
+			const VertexMap &m, const GraphFinderDom &gFinderDom, const GraphFinderCodom &gFinderCodom) const {
+		if(!checks.empty()) {
+			const auto &vChecks = checks[get(boost::vertex_index_t(), gFinderDom, vDom)];
+			for(const auto *c : vChecks.adjacencies)
+				if(!c->matchesString(lgCodom, vCodom)) return false;
+			for(const auto &p : vChecks.paths) {
+				const auto vOtherCodom = get(m, gFinderDom, gFinderCodom, p.vOther);
+				if(vOtherCodom == boost::graph_traits<GraphFinderCodom>::null_vertex()) continue;
+				const bool ok = p.isSrc
+						? p.c->template matchesImages<GraphCodom>(vCodom, vOtherCodom, *distances)
+						: p.c->template matchesImages<GraphCodom>(vOtherCodom, vCodom, *distances);
+				if(!ok) return false;
+			}
+		}
+		return jla_boost::GraphMorphism::partialPredicate(next, vDom, vCodom, m, gFinderDom, gFinderCodom);
+	}
+private:
+	struct PathCheck {
+		PathCheck(const ShortestPath<GraphDom> *c, Vertex vOther, bool isSrc) : c(c), vOther(vOther), isSrc(isSrc) { }
+	public:
+		const ShortestPath<GraphDom> *c;
+		Vertex vOther; // the other end of the path
+		bool isSrc; // whether the vertex with these checks is the source of the path
+	};
+
+	struct VertexChecks {
+		std::vector<const VertexAdjacency<GraphDom>*> adjacencies;
+		std::vector<PathCheck> paths;
+	};
+
+	template<typename GraphFinderDom>
+	struct Collector : AllVisitor<GraphDom> {
+
+		Collector(PartialChecker &self, const GraphFinderDom &gFinderDom, LabelSettings ls)
+		: self(self), gFinderDom(gFinderDom), ls(ls) { }
+
+		virtual void operator()(const VertexAdjacency<GraphDom> &c) override {
+			// with term labels the count also depends on the unifier from the rest of the morphism
+			if(ls.type != LabelType::String) return;
+			const auto vId = getIndex(c.vConstrained);
+			if(vId == num_vertices(gFinderDom)) return;
+			getChecks(vId).adjacencies.push_back(&c);
+		}
+
+		virtual void operator()(const ShortestPath<GraphDom> &c) override {
+			if(c.vSrc == c.vTar) return;
+			const auto vSrcId = getIndex(c.vSrc);
+			const auto vTarId = getIndex(c.vTar);
+			if(vSrcId == num_vertices(gFinderDom) || vTarId == num_vertices(gFinderDom)) return;
+			getChecks(vSrcId).paths.emplace_back(&c, c.vTar, true);
+			getChecks(vTarId).paths.emplace_back(&c, c.vSrc, false);
+		}
+	private:
+		// returns num_vertices(gFinderDom) if v is not in the finder domain
+		std::size_t getIndex(Vertex v) const {
+			for(const auto vFinder : asRange(vertices(gFinderDom)))
+				if(vFinder == v) return get(boost::vertex_index_t(), gFinderDom, vFinder);
+			return num_vertices(gFinderDom);
+		}
+
+		VertexChecks &getChecks(std::size_t vId) {
+			if(self.checks.empty()) self.checks.resize(num_vertices(gFinderDom));
+			return self.checks[vId];
+		}
+	private:
+		PartialChecker &self;
+		const GraphFinderDom &gFinderDom;
+		const LabelSettings ls;
+	};
+private:
+	const LabelledGraphCodom &lgCodom;
+	std::shared_ptr<DistanceCache<GraphCodom> > distances;
+	Next next;
+	// indexed by the vertices of the finder domain, and empty if there is nothing to check
+	std::vector<VertexChecks> checks;
+};
+
+// A predicate wrapper (see lib::GraphMorphism::morphismSelectByLabelSettings) adding a PartialChecker.
+template<typename GraphDom, typename ConstraintRange, typename LabelledGraphCodom>
+struct PartialCheckerWrapper {
+	using GraphCodom = typename LabelledGraphTraits<LabelledGraphCodom>::GraphType;
+public:
+
+	PartialCheckerWrapper(ConstraintRange constraints, const LabelledGraphCodom &lgCodom, LabelSettings ls,
+			std::shared_ptr<DistanceCache<GraphCodom> > distances)
+	: constraints(constraints), lgCodom(lgCodom), ls(ls), distances(distances) { }
+
+	template<typename LabGraphDom, typename LabGraphCodom, typename Pred>
+	auto operator()(const LabGraphDom &gDomain, const LabGraphCodom &gCodomain, Pred pred) const {
+		return PartialChecker<GraphDom, LabelledGraphCodom, Pred>(constraints, get_graph(gDomain), lgCodom, ls, distances, pred);
+	}
+private:
+	ConstraintRange constraints;
+	const LabelledGraphCodom &lgCodom;
+	LabelSettings ls;
+	std::shared_ptr<DistanceCache<GraphCodom> > distances;
+};
+
+template<typename GraphDom, typename ConstraintRange, typename LabelledGraphCodom>
+PartialCheckerWrapper<GraphDom, ConstraintRange, LabelledGraphCodom>
+makePartialCheckerWrapper(ConstraintRange constraints, const LabelledGraphCodom &lgCodom, LabelSettings ls,
+		std::shared_ptr<DistanceCache<typename LabelledGraphTraits<LabelledGraphCodom>::GraphType> > distances) {
+	return PartialCheckerWrapper<GraphDom, ConstraintRange, LabelledGraphCodom>(constraints, lgCodom, ls, distances);
 }
 
 } // namespace Constraints
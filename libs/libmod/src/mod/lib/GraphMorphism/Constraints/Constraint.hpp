@@ -4,6 +4,7 @@
 #include <mod/lib/GraphMorphism/Constraints/Visitor.hpp>
 
 #include <cassert>
+#include <cstdlib>
 #include <memory>
 
 #include <iostream>
@@ -47,6 +48,19 @@ enum class Operator {
 	EQ, LT, GT, LEQ, GEQ
 };
 
+// returns whether 'lhs op rhs' holds
+inline bool compare(Operator op, int lhs, int rhs) {
+	switch(op) {
+	case Operator::EQ: return lhs == rhs;
+	case Operator::LT: return lhs < rhs;
+	case Operator::GT: return lhs > rhs;
+	case Operator::LEQ: return lhs <= rhs;
+	case Operator::GEQ: return lhs >= rhs;
+	}
+	assert(false);
+	std::abort();
+}
+
 } // namespace Constraints
 } // namespace GraphMorphism
 } // namespace lib
@@ -7,13 +7,69 @@
 
 #include <jla_boost/graph/morphism/VertexMap.hpp>
 
-#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
 
 namespace mod {
 namespace lib {
 namespace GraphMorphism {
 namespace Constraints {
 
+// The unit-weight distances in a single graph.
+// Each query continues a breadth-first search from the source, which is kept for later queries from the same source,
+// and the search stops as soon as the queried distance is known.
+template<typename Graph>
+struct DistanceCache {
+	using Vertex = typename boost::graph_traits<Graph>::vertex_descriptor;
+	static constexpr int Unreachable = std::numeric_limits<int>::max();
+public:
+
+	explicit DistanceCache(const Graph &g) : g(g) { }
+
+	// returns the distance from vSrc to vTar if it is at most limit, and Unreachable otherwise
+	int distance(Vertex vSrc, Vertex vTar, int limit) {
+		if(searches.empty()) searches.resize(num_vertices(g));
+		const auto vSrcId = get(boost::vertex_index_t(), g, vSrc);
+		auto &search = searches[vSrcId];
+		if(!search) {
+			search = std::make_unique<Search>();
+			search->distance.resize(num_vertices(g), Unreachable);
+			search->distance[vSrcId] = 0;
+			search->queue.push_back(vSrc);
+		}
+		const int &dTar = search->distance[get(boost::vertex_index_t(), g, vTar)];
+		while(dTar == Unreachable && search->head != search->queue.size()) {
+			const auto v = search->queue[search->head];
+			const int d = search->distance[get(boost::vertex_index_t(), g, v)];
+			// all vertices not yet reached are further away than limit
+			if(d >= limit) break;
+			++search->head;
+			for(const auto e : asRange(out_edges(v, g))) {
+				const auto vAdj = target(e, g);
+				int &dAdj = search->distance[get(boost::vertex_index_t(), g, vAdj)];
+				if(dAdj != Unreachable) continue;
+				dAdj = d + 1;
+				search->queue.push_back(vAdj);
+			}
+		}
+		return dTar <= limit ? dTar : Unreachable;
+	}
+private:
+	struct Search {
+		std::vector<int> distance;
+		std::vector<Vertex> queue;
+		std::size_t head = 0;
+	};
+private:
+	const Graph &g;
+	// indexed by the source vertex
+	std::vector<std::unique_ptr<Search> > searches;
+};
+
+template<typename Graph>
+constexpr int DistanceCache<Graph>::Unreachable;
+
 template<typename Graph>
 struct ShortestPath : Constraint<Graph> {
 	MOD_VISITABLE();
@@ -35,6 +91,20 @@ public:
 		return true;
 	}
 
+	// vSrcCodom and vTarCodom are the images of vSrc and vTar, or the null vertex if they are not mapped
+	template<typename GraphCodom>
+	bool matchesImages(typename boost::graph_traits<GraphCodom>::vertex_descriptor vSrcCodom,
+			typename boost::graph_traits<GraphCodom>::vertex_descriptor vTarCodom,
+			DistanceCache<GraphCodom> &distances) const {
+		const auto vRightNull = boost::graph_traits<GraphCodom>::null_vertex();
+		if(vSrcCodom == vRightNull && vTarCodom == vRightNull) return true;
+		if(vSrcCodom == vRightNull || vTarCodom == vRightNull)
+			return compare(op, std::numeric_limits<int>::max(), length);
+		// a distance larger than the length compares as any other larger distance
+		return compare(op, distances.distance(vSrcCodom, vTarCodom, length), length);
+	}
+
+	// the visitor must provide the distances of the codomain graph as vis.distances
 	template<typename Visitor, typename LabelledGraphCodom, typename VertexMap>
 	bool matches(Visitor &vis, const Graph &gDom, const LabelledGraphCodom &lgCodom, const VertexMap &m, const LabelSettings ls) const {
 		using GraphCodom = typename LabelledGraphTraits<LabelledGraphCodom>::GraphType;
@@ -48,35 +118,9 @@ public:
 			assert(std::find(vs.first, vs.second, vTar) != vs.second);
 #endif
 		}
-		const auto check = [this](int length) -> bool {
-			switch(op) {
-			case Operator::EQ: return length == this->length;
-			case Operator::LT: return length < this->length;
-			case Operator::GT: return length > this->length;
-			case Operator::LEQ: return length <= this->length;
-			case Operator::GEQ: return length >= this->length;
-			}
-			assert(false);
-			std::abort();
-		};
 		const auto vSrcCodom = get(m, gDom, gCodom, vSrc);
 		const auto vTarCodom = get(m, gDom, gCodom, vTar);
-		const auto vRightNull = boost::graph_traits<GraphCodom>::null_vertex();
-		if(vSrcCodom == vRightNull && vTarCodom == vRightNull) return true;
-		if(vSrcCodom == vRightNull || vTarCodom == vRightNull) {
-			return check(std::numeric_limits<int>::max());
-		}
-		using VertexCodom = typename boost::graph_traits<GraphCodom>::vertex_descriptor;
-		using EdgeCodom = typename boost::graph_traits<GraphCodom>::edge_descriptor;
-		std::vector<int> distance(num_vertices(gCodom));
-		std::vector<VertexCodom> predesc(num_vertices(gCodom));
-		auto distanceMap = boost::make_iterator_property_map(distance.begin(), get(boost::vertex_index_t(), gCodom));
-		auto predescMap = boost::make_iterator_property_map(predesc.begin(), get(boost::vertex_index_t(), gCodom));
-
-		boost::dijkstra_shortest_paths(gCodom, vSrcCodom, distance_map(distanceMap).predecessor_map(predescMap)
-				.weight_map(boost::make_constant_property<EdgeCodom>(1)));
-		const auto length = distance[get(boost::vertex_index_t(), gCodom, vTarCodom)];
-		return check(length);
+		return matchesImages<GraphCodom>(vSrcCodom, vTarCodom, vis.distances);
 	}
 public:
 	Vertex vSrc, vTar;
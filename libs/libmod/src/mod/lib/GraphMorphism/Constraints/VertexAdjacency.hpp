@@ -39,12 +39,10 @@ public:
 	}
 private:
 
-	template<typename Visitor, typename LabelledGraphCodom, typename VertexMap>
-	int matchesImpl(Visitor &vis, const Graph &gDom, const LabelledGraphCodom &lgCodom, VertexMap &m, const LabelSettings ls, std::false_type) const {
-		assert(ls.type == LabelType::String); // otherwise someone forgot to add the TermData prop
-		using GraphCodom = typename LabelledGraphTraits<LabelledGraphCodom>::GraphType;
-		const GraphCodom &gCodom = get_graph(lgCodom);
-		const auto vCodom = get(m, gDom, gCodom, vConstrained);
+	template<typename LabelledGraphCodom>
+	int countString(const LabelledGraphCodom &lgCodom,
+			typename boost::graph_traits<typename LabelledGraphTraits<LabelledGraphCodom>::GraphType>::vertex_descriptor vCodom) const {
+		const auto &gCodom = get_graph(lgCodom);
 		int count = 0;
 		const auto &string = get_string(lgCodom);
 		for(const auto eOutCodom : asRange(out_edges(vCodom, gCodom))) {
@@ -61,6 +59,12 @@ private:
 		return count;
 	}
 
+	template<typename Visitor, typename LabelledGraphCodom, typename VertexMap>
+	int matchesImpl(Visitor &vis, const Graph &gDom, const LabelledGraphCodom &lgCodom, VertexMap &m, const LabelSettings ls, std::false_type) const {
+		assert(ls.type == LabelType::String); // otherwise someone forgot to add the TermData prop
+		return countString(lgCodom, get(m, gDom, get_graph(lgCodom), vConstrained));
+	}
+
 	template<typename Visitor, typename LabelledGraphCodom, typename VertexMap>
 	int matchesImpl(Visitor &vis, const Graph &gDom, const LabelledGraphCodom &lgCodom, VertexMap &m, const LabelSettings ls, std::true_type) const {
 		assert(ls.type == LabelType::Term); // otherwise someone did something very strange
@@ -122,15 +126,15 @@ public:
 
 		using HasTerm = GraphMorphism::HasTermData<VertexMap>;
 		const int count = matchesImpl(vis, gDom, lgCodom, m, ls, HasTerm());
-		switch(op) {
-		case Operator::EQ: return count == this->count;
-		case Operator::LT: return count < this->count;
-		case Operator::GT: return count > this->count;
-		case Operator::LEQ: return count <= this->count;
-		case Operator::GEQ: return count >= this->count;
-		}
-		assert(false);
-		std::abort();
+		return compare(op, count, this->count);
+	}
+
+	// Checks the constraint when vConstrained is mapped to vCodom, using string labels.
+	// This only depends on vCodom, so it can be done as soon as vConstrained is mapped.
+	template<typename LabelledGraphCodom>
+	bool matchesString(const LabelledGraphCodom &lgCodom,
+			typename boost::graph_traits<typename LabelledGraphTraits<LabelledGraphCodom>::GraphType>::vertex_descriptor vCodom) const {
+		return compare(op, countString(lgCodom, vCodom), count);
 	}
 public:
 	Vertex vConstrained;
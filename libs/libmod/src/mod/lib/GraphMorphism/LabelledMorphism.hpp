@@ -80,12 +80,32 @@ ArgsProvider<OuterGraph> makeArgsProvider(const OuterGraph &gOuter) {
 
 namespace GM = jla_boost::GraphMorphism;
 
+// The predicate given to the finder, which also forwards the partial predicate of the outer predicate, if any.
+template<typename LabGraphDom, typename LabGraphCodom, typename PredOuter>
+struct FinderPred {
+
+	FinderPred(const PredOuter &predOuter, const LabGraphDom &gDom, const LabGraphCodom &gCodom)
+	: predOuter(predOuter), gDom(gDom), gCodom(gCodom) { }
+
+	template<typename VEDom, typename VECodom>
+	bool operator()(const VEDom &l, const VECodom &r) const {
+		return predOuter(l, r, gDom, gCodom);
+	}
+
+	template<typename VDom, typename VCodom, typename VertexMap, typename GraphDom, typename GraphCodom>
+	bool partial(const VDom &vDom, const VCodom &vCodom, const VertexMap &m, const GraphDom &gFinderDom, const GraphCodom &gFinderCodom) const {
+		return GM::partialPredicate(predOuter, vDom, vCodom, m, gFinderDom, gFinderCodom);
+	}
+private:
+	const PredOuter &predOuter;
+	const LabGraphDom &gDom;
+	const LabGraphCodom &gCodom;
+};
+
 template<typename LabGraphDom, typename LabGraphCodom, typename MR, typename Finder, typename PredWrapper, typename MRWrapper>
 bool morphismFinallyDoIt(const LabGraphDom &gDom, const LabGraphCodom &gCodom, Finder finder, MR mr, PredWrapper predWrapper, MRWrapper mrWrapper) {
 	auto predOuter = predWrapper(gDom, gCodom, jla_boost::AlwaysTrue());
-	auto pred = [&predOuter, &gDom, &gCodom](const auto &l, const auto &r) {
-		return predOuter(l, r, gDom, gCodom);
-	};
+	const auto pred = FinderPred<LabGraphDom, LabGraphCodom, decltype(predOuter)>(predOuter, gDom, gCodom);
 	auto mrWrapped = mrWrapper(gDom, gCodom, mr);
 	return finder(get_graph(gDom), get_graph(gCodom), mrWrapped, pred, pred,
 			makeArgsProvider(gDom), makeArgsProvider(gCodom));
@@ -118,6 +138,40 @@ bool morphismSelectTermRelation(const LabGraphDom &gDomain, const LabGraphCodom
 
 //------------------------------------------------------------------------------
 
+// String labels are compared through their interned ids when both properties provide them.
+
+template<typename PropDom, typename PropCodom, typename VEDom, typename VECodom>
+auto stringLabelsEqual(const PropDom &pDom, const PropCodom &pCodom, const VEDom &veDom, const VECodom &veCodom, int)
+-> decltype(get_label_id(pDom, veDom) == get_label_id(pCodom, veCodom)) {
+	return get_label_id(pDom, veDom) == get_label_id(pCodom, veCodom);
+}
+
+template<typename PropDom, typename PropCodom, typename VEDom, typename VECodom>
+bool stringLabelsEqual(const PropDom &pDom, const PropCodom &pCodom, const VEDom &veDom, const VECodom &veCodom, long) {
+	return get(pDom, veDom) == get(pCodom, veCodom);
+}
+
+template<typename PropDom, typename PropCodom, typename Next>
+struct StringLabelPred {
+
+	StringLabelPred(PropDom pDom, PropCodom pCodom, Next next) : pDom(pDom), pCodom(pCodom), next(next) { }
+
+	template<typename VEDom, typename VECodom, typename ...Args>
+	bool operator()(const VEDom &veDom, const VECodom &veCodom, Args&&... args) const {
+		return stringLabelsEqual(pDom, pCodom, veDom, veCodom, 0)
+				&& next(veDom, veCodom, std::forward<Args>(args)...);
+	}
+private:
+	PropDom pDom;
+	PropCodom pCodom;
+	Next next;
+};
+
+template<typename PropDom, typename PropCodom, typename Next>
+auto makeStringLabelPred(PropDom &&pDom, PropCodom &&pCodom, Next next) {
+	return StringLabelPred<PropDom, PropCodom, Next>(std::forward<PropDom>(pDom), std::forward<PropCodom>(pCodom), next);
+}
+
 template<typename PredWrapper>
 struct StringLabelPredWrapper {
 	PredWrapper predWrapper;
@@ -127,7 +181,7 @@ public:
 
 	template<typename LabGraphDom, typename LabGraphCodom, typename Pred>
 	auto operator()(const LabGraphDom &gDomain, const LabGraphCodom &gCodomain, Pred pred) const {
-		return predWrapper(gDomain, gCodomain, GM::makePropertyPredicateEq(get_string(gDomain), get_string(gCodomain), pred));
+		return predWrapper(gDomain, gCodomain, makeStringLabelPred(get_string(gDomain), get_string(gCodomain), pred));
 	}
 };
 
@@ -43,6 +43,7 @@ using Vertex = lib::DG::HyperVertex;
 using Edge = lib::DG::HyperEdge;
 
 std::string dump(const lib::DG::NonHyper &dg);
+std::string dumpBinary(const lib::DG::NonHyper &dg);
 
 std::string dotNonHyper(const lib::DG::NonHyper &nonHyper);
 std::string pdfNonHyper(const lib::DG::NonHyper &nonHyper);
@@ -34,6 +34,12 @@ std::string dump(const lib::DG::NonHyper &dg) {
 	return s;
 }
 
+std::string dumpBinary(const lib::DG::NonHyper &dg) {
+	FileHandle s(getUniqueFilePrefix() + "DG.dgb");
+	lib::DG::Dump::writeBinary(dg, s);
+	return s;
+}
+
 std::string dotNonHyper(const lib::DG::NonHyper &nonHyper) {
 	FileHandle s(getUniqueFilePrefix() + "dgNonHyper_" + boost::lexical_cast<std::string>(nonHyper.getId()) + ".dot");
 	{ // printing
@@ -4,6 +4,7 @@
 #include <mod/lib/Graph/GraphDecl.hpp>
 
 #include <istream>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -18,6 +18,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <set>
+
 namespace mod {
 namespace lib {
 namespace IO {
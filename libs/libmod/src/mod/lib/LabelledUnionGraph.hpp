@@ -19,6 +19,10 @@ public:
 public:
 
 	UnionPropBase(const std::vector<const LGraph*> &lgs) : lgs(lgs) { }
+
+	const LGraph &getLabelledGraph(std::size_t gIdx) const {
+		return *lgs[gIdx];
+	}
 protected:
 	const std::vector<const LGraph*> &lgs;
 };
@@ -49,6 +53,18 @@ MOD_MAKE_UNION_PROP(Stereo, stereo);
 MOD_MAKE_UNION_PROP(Molecule, molecule);
 #undef MOD_MAKE_UNION_PROP
 
+template<typename LGraph>
+auto get_label_id(const UnionPropString<LGraph> &up, const typename UnionPropString<LGraph>::Vertex v)
+-> decltype(get_label_id(get_string(up.getLabelledGraph(v.gIdx)), v.v)) {
+	return get_label_id(get_string(up.getLabelledGraph(v.gIdx)), v.v);
+}
+
+template<typename LGraph>
+auto get_label_id(const UnionPropString<LGraph> &up, const typename UnionPropString<LGraph>::Edge e)
+-> decltype(get_label_id(get_string(up.getLabelledGraph(e.gIdx)), e.e)) {
+	return get_label_id(get_string(up.getLabelledGraph(e.gIdx)), e.e);
+}
+
 } // namespace detail
 
 template<typename LGraph>
@@ -0,0 +1,54 @@
+#ifndef MOD_LIB_ONCE_FLAG_H
+#define MOD_LIB_ONCE_FLAG_H
+
+#include <atomic>
+#include <mutex>
+
+namespace mod {
+namespace lib {
+
+// Guards the initialisation of a lazily computed member, such that the first accesses may happen concurrently.
+// It is like std::once_flag, except that
+// - copies and moves take over the state, so the defaulted special members of the owner remain correct,
+// - if the initialisation throws, the flag stays unset and a later call tries again,
+// - whether the initialisation has happened can be queried.
+// When the flag is set, callOnce only costs an acquire load.
+// The initialisation may itself initialise other members, but not the one guarded by the same flag.
+struct OnceFlag {
+	OnceFlag() = default;
+
+	OnceFlag(const OnceFlag &other) : done(other.isDone()) {}
+
+	OnceFlag &operator=(const OnceFlag &other) {
+		done.store(other.isDone(), std::memory_order_relaxed);
+		return *this;
+	}
+
+	bool isDone() const {
+		return done.load(std::memory_order_acquire);
+	}
+
+	// Calls f, unless a previous call returned normally.
+	// Concurrent calls wait for the one calling f, and return after it.
+	template<typename F>
+	void callOnce(F f) {
+		if(isDone()) return;
+		std::lock_guard<std::mutex> lock(mtx);
+		if(done.load(std::memory_order_relaxed)) return;
+		f();
+		done.store(true, std::memory_order_release);
+	}
+
+	// For invalidating the member. Must not be called concurrently with anything else.
+	void reset() {
+		done.store(false, std::memory_order_relaxed);
+	}
+private:
+	std::atomic<bool> done{false};
+	std::mutex mtx;
+};
+
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_ONCE_FLAG_H */
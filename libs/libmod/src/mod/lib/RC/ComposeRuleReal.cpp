@@ -25,6 +25,15 @@ MOD_RC_COMPOSE_BY_MATCH_MAKER(Sub);
 MOD_RC_COMPOSE_BY_MATCH_MAKER(Super);
 #undef MOD_RC_COMPOSE_BY_MATCH_MAKER
 
+void prepareForComposition(const lib::Rules::Real &r, LabelSettings labelSettings) {
+	const auto &rDPO = r.getDPORule();
+	get_left(rDPO);
+	get_context(rDPO);
+	get_right(rDPO);
+	get_molecule(rDPO);
+	if(labelSettings.type == LabelType::Term) get_term(rDPO);
+	if(labelSettings.withStereo) get_stereo(rDPO);
+}
 
 } // namespace RC
 } // namespace lib
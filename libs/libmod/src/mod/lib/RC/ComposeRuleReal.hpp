@@ -30,6 +30,10 @@ MOD_RC_COMPOSE_BY_MATCH_MAKER(Sub);
 MOD_RC_COMPOSE_BY_MATCH_MAKER(Super);
 #undef MOD_RC_COMPOSE_BY_MATCH_MAKER
 
+// Computes the lazily initialised data of a rule which is accessed during composition,
+// e.g., such that concurrent compositions do not wait for each other on the first accesses.
+void prepareForComposition(const lib::Rules::Real &r, LabelSettings labelSettings);
+
 } // namespace RC
 } // namespace lib
 } // namespace mod
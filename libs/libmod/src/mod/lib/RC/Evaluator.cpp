@@ -11,6 +11,7 @@
 #include <mod/lib/RC/MatchMaker/Parallel.hpp>
 #include <mod/lib/RC/MatchMaker/Sub.hpp>
 #include <mod/lib/RC/MatchMaker/Super.hpp>
+#include <mod/lib/ThreadPool.hpp>
 
 #include <boost/variant/static_visitor.hpp>
 
@@ -61,26 +62,51 @@ struct EvalVisitor : public boost::static_visitor<std::unordered_set<std::shared
 	// Binary
 	//----------------------------------------------------------------------
 
+	// The pairs of rules are composed concurrently in chunks, when possible.
+	// Each chunk is afterwards processed serially in the order of the pairs,
+	// so the database and the expression graph are updated as in a serial evaluation.
 	template<typename Composer>
 	std::unordered_set<std::shared_ptr<rule::Rule> > composeTemplate(
 			const rule::RCExp::ComposeBase &compose, Composer composer) {
 		auto firstResult = compose.getFirst().applyVisitor(*this);
 		auto secondResult = compose.getSecond().applyVisitor(*this);
+		std::vector<std::pair<std::shared_ptr<rule::Rule>, std::shared_ptr<rule::Rule> > > pairs;
+		pairs.reserve(firstResult.size() * secondResult.size());
+		for(auto rFirst : firstResult)
+			for(auto rSecond : secondResult)
+				pairs.emplace_back(rFirst, rSecond);
+
+		const bool parallel = canComposeInParallel();
+		if(parallel) {
+			for(const auto &r : firstResult) prepareForComposition(r->getRule(), evaluator.labelSettings);
+			for(const auto &r : secondResult) prepareForComposition(r->getRule(), evaluator.labelSettings);
+		}
+		const std::size_t chunkSize = parallel ? std::size_t(getConfig().common.numThreads.get()) * 16 : 1;
+		std::vector<std::vector<std::unique_ptr<lib::Rules::Real> > > results;
 		std::unordered_set<std::shared_ptr<rule::Rule> > result;
-		for(auto rFirst : firstResult) {
-			for(auto rSecond : secondResult) {
-				std::vector<lib::Rules::Real *> resultVec;
+		for(std::size_t chunkBegin = 0; chunkBegin < pairs.size(); chunkBegin += chunkSize) {
+			const std::size_t chunkEnd = std::min(pairs.size(), chunkBegin + chunkSize);
+			results.clear();
+			results.resize(chunkEnd - chunkBegin);
+			const auto composeOne = [&](std::size_t i) {
+				auto &resultVec = results[i];
 				auto reporter = [&resultVec](std::unique_ptr<lib::Rules::Real> r) {
-					resultVec.push_back(r.release());
+					resultVec.push_back(std::move(r));
 					return true;
 				};
-				composer(rFirst->getRule(), rSecond->getRule(), reporter);
-				for(auto *r : resultVec) {
-					if(compose.getDiscardNonchemical() && !r->isChemical()) {
-						delete r;
+				const auto &p = pairs[chunkBegin + i];
+				composer(p.first->getRule(), p.second->getRule(), reporter);
+			};
+			if(parallel) lib::parallelForEach(chunkEnd - chunkBegin, composeOne);
+			else for(std::size_t i = 0; i != chunkEnd - chunkBegin; ++i) composeOne(i);
+
+			for(std::size_t i = 0; i != results.size(); ++i) {
+				const auto &rFirst = pairs[chunkBegin + i].first;
+				const auto &rSecond = pairs[chunkBegin + i].second;
+				for(auto &r : results[i]) {
+					if(compose.getDiscardNonchemical() && !r->isChemical())
 						continue;
-					}
-					auto rWrapped = evaluator.checkIfNew(r);
+					auto rWrapped = evaluator.checkIfNew(r.release());
 					bool isNew = evaluator.addRule(rWrapped);
 					if(isNew) evaluator.giveProductStatus(rWrapped);
 					evaluator.suggestComposition(&rFirst->getRule(), &rSecond->getRule(), &rWrapped->getRule());
@@ -91,6 +117,14 @@ struct EvalVisitor : public boost::static_visitor<std::unordered_set<std::shared
 		return result;
 	}
 
+	bool canComposeInParallel() const {
+		if(getConfig().common.numThreads.get() <= 1) return false;
+		// the output for each composition would be interleaved
+		if(verbosity > 0) return false;
+		if(getConfig().rc.printMatches.get()) return false;
+		return true;
+	}
+
 	std::unordered_set<std::shared_ptr<rule::Rule> > operator()(const rule::RCExp::ComposeCommon &common) {
 		const auto composer = [&common, this](const lib::Rules::Real &rFirst, const lib::Rules::Real &rSecond,
 														  std::function<bool(std::unique_ptr<lib::Rules::Real>)> reporter) {
@@ -141,6 +175,8 @@ private:
 
 Evaluator::Evaluator(std::unordered_set<std::shared_ptr<rule::Rule> > database, LabelSettings labelSettings)
 		: labelSettings(labelSettings), database(database) {
+	for(const auto &r : this->database)
+		databaseIndex[lib::Rules::Real::isomorphismHash(r->getRule(), labelSettings.type, labelSettings.withStereo)].push_back(r);
 	if(labelSettings.type == LabelType::Term) {
 		for(const auto r : database) {
 			const auto &term = get_term(r->getRule().getDPORule());
@@ -235,7 +271,9 @@ const Evaluator::GraphType &Evaluator::getGraph() const {
 }
 
 bool Evaluator::addRule(std::shared_ptr<rule::Rule> r) {
-	return database.insert(r).second;
+	const bool isNew = database.insert(r).second;
+	if(isNew) databaseIndex[lib::Rules::Real::isomorphismHash(r->getRule(), labelSettings.type, labelSettings.withStereo)].push_back(r);
+	return isNew;
 }
 
 void Evaluator::giveProductStatus(std::shared_ptr<rule::Rule> r) {
@@ -243,11 +281,14 @@ void Evaluator::giveProductStatus(std::shared_ptr<rule::Rule> r) {
 }
 
 std::shared_ptr<rule::Rule> Evaluator::checkIfNew(lib::Rules::Real *rCand) const {
-	for(auto rOther : database) {
-		if(lib::Rules::makeIsomorphismPredicate(labelSettings.type, labelSettings.withStereo)
-				(&rOther->getRule(), rCand)) {
-			delete rCand;
-			return rOther;
+	const auto iter = databaseIndex.find(lib::Rules::Real::isomorphismHash(*rCand, labelSettings.type, labelSettings.withStereo));
+	if(iter != end(databaseIndex)) {
+		for(const auto &rOther : iter->second) {
+			if(lib::Rules::makeIsomorphismPredicate(labelSettings.type, labelSettings.withStereo)
+					(&rOther->getRule(), rCand)) {
+				delete rCand;
+				return rOther;
+			}
 		}
 	}
 	return rule::Rule::makeRule(std::unique_ptr<lib::Rules::Real>(rCand));
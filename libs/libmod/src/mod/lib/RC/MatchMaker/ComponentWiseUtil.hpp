@@ -85,6 +85,7 @@ WrappedComponentGraph<Rule> makeWrappedComponentGraph(const typename Rule::Compo
 template<typename RuleSideDom, typename RuleSideCodom>
 struct RuleRuleComponentMonomorphism {
 	using Morphism = GM::VectorVertexMap<typename RuleSideDom::GraphType, typename RuleSideCodom::GraphType>;
+	using DistanceCache = GM_MOD::Constraints::DistanceCache<typename RuleSideCodom::GraphType>;
 public:
 
 	RuleRuleComponentMonomorphism(const RuleSideDom &rsDom,
@@ -93,7 +94,7 @@ public:
 											LabelSettings labelSettings,
 											bool verbose, IO::Logger &logger)
 			: rsDom(rsDom), rsCodom(rsCodom), enforceConstraints(enforceConstraints), labelSettings(labelSettings),
-			  verbose(verbose), logger(logger) {}
+			  verbose(verbose), logger(logger), distances(std::make_shared<DistanceCache>(get_graph(rsCodom))) {}
 
 	std::vector<Morphism> operator()(const std::size_t idDom, const std::size_t idCodom) const {
 		std::vector<Morphism> morphisms;
@@ -103,16 +104,15 @@ public:
 		auto wgDom = makeWrappedComponentGraph(gDom, idDom, rsDom);
 		auto wgCodom = makeWrappedComponentGraph(gCodom, idCodom, rsCodom);
 
+		const auto &constraints = get_match_constraints(rsDom);
+		const auto constraintsRange = asRange(std::make_pair(constraints.begin(),
+				enforceConstraints ? constraints.end() : constraints.begin()));
 		auto makeCheckConstraints = [&](auto &&mrNext) {
-			const auto &constraints = get_match_constraints(rsDom);
-			auto constraintsIterEnd = enforceConstraints ? constraints.end() : constraints.begin();
 			if(verbose)
 				logger.indent() << "RuleRuleComponentMonomorphism(" << idDom << ", " << idCodom
 									 << ")::makeCheckConstraints: "
-									 << std::distance(constraints.begin(), constraintsIterEnd) << std::endl;
-			return GraphMorphism::Constraints::makeChecker(
-					asRange(std::make_pair(constraints.begin(), constraintsIterEnd)),
-					rsCodom, labelSettings, mrNext);
+									 << std::distance(constraintsRange.begin(), constraintsRange.end()) << std::endl;
+			return GraphMorphism::Constraints::makeChecker(constraintsRange, rsCodom, labelSettings, distances, mrNext);
 		};
 		// First reinterpret the vertex descriptors from the reindexed graphs to their parent graphs.
 		auto mrWrapper = FilteredWrapperReinterpretMRWrapper<RuleSideDom, RuleSideCodom>();
@@ -137,7 +137,10 @@ public:
 																		mrStore
 																)))))//))
 		;
-		auto predWrapper = lib::GraphMorphism::IdentityWrapper();
+		// Constraints which are determined by a partial morphism are also checked during the search,
+		// to prune it early.
+		auto predWrapper = GraphMorphism::Constraints::makePartialCheckerWrapper<typename RuleSideDom::GraphType>(
+				constraintsRange, rsCodom, labelSettings, distances);
 
 		//				auto mrPrinter = GraphMorphism::Callback::makePrint(IO::log(), patternWrapped, targetWrapped, mrCheckConstraints);
 		lib::GraphMorphism::morphismSelectByLabelSettings(wgDom, wgCodom, labelSettings, GM_MOD::VF2Monomorphism(), mr,
@@ -156,6 +159,8 @@ private:
 	const LabelSettings labelSettings;
 	const bool verbose;
 	IO::Logger &logger;
+	// shared by all component pairs, as the codomain is the same
+	std::shared_ptr<DistanceCache> distances;
 };
 
 template<typename RuleSideDom, typename RuleSideCodom>
@@ -0,0 +1,30 @@
+#include "HostSymmetry.hpp"
+
+#include <mod/lib/Graph/Canonicalisation.hpp>
+#include <mod/lib/Graph/Single.hpp>
+
+#include <cassert>
+
+namespace mod {
+namespace lib {
+namespace RC {
+
+bool canUseHostSymmetry(const lib::Graph::Single &g, LabelSettings labelSettings) {
+	// the automorphism groups are only available through the canonicalisation
+	return labelSettings.type == LabelType::String && !labelSettings.withStereo
+	       && lib::Graph::canCanonicalise(g, labelSettings.type, false);
+}
+
+void prepareHostSymmetry(const lib::Graph::Single &g, LabelSettings labelSettings) {
+	assert(canUseHostSymmetry(g, labelSettings));
+	g.getAutPerms(labelSettings.type, false);
+}
+
+HostSymmetry makeHostSymmetry(const lib::Graph::Single &g, LabelSettings labelSettings) {
+	assert(canUseHostSymmetry(g, labelSettings));
+	return HostSymmetry(g.getAutPerms(labelSettings.type, false));
+}
+
+} // namespace RC
+} // namespace lib
+} // namespace mod
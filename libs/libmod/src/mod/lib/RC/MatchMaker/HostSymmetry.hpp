@@ -0,0 +1,83 @@
+#ifndef MOD_LIB_RC_MATCH_MAKER_HOST_SYMMETRY_H
+#define MOD_LIB_RC_MATCH_MAKER_HOST_SYMMETRY_H
+
+#include <mod/Config.hpp>
+
+#include <jla_boost/graph/PairToRangeAdaptor.hpp>
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace mod {
+namespace lib {
+namespace Graph {
+struct Single;
+} // namespace Graph
+namespace RC {
+
+// Automorphisms of the codomain of the matches, i.e., of the right side of the first rule.
+// Two matches which are mapped to each other by an automorphism give isomorphic compositions,
+// so only the lexicographically smallest match of each orbit must be composed.
+// The automorphisms need not form a group: the smallest match of an orbit is kept for any subset of the group,
+// so the group can be truncated to bound the cost of the test.
+// The permutations are only referenced, e.g., cached in the graph, while the scratch state and the number of
+// pruned matches belong to each object, so use an object per composition.
+struct HostSymmetry {
+	using Perms = std::vector<std::vector<std::size_t> >;
+	// Each permutation maps vertex indices to vertex indices, and they should not be the identity.
+	// The permutations must outlive this object.
+	explicit HostSymmetry(const Perms &perms) : perms(&perms) {}
+
+	// Returns false if an automorphism maps the match to a lexicographically smaller match,
+	// comparing the images of the domain vertices in order.
+	template<typename VertexMap, typename GraphDom, typename GraphCodom>
+	bool isSmallestInOrbit(const VertexMap &m, const GraphDom &gDom, const GraphCodom &gCodom) const {
+		const auto vNullCodom = boost::graph_traits<GraphCodom>::null_vertex();
+		images.clear();
+		for(const auto vDom : asRange(vertices(gDom))) {
+			const auto vCodom = get(m, gDom, gCodom, vDom);
+			if(vCodom != vNullCodom) images.push_back(get(boost::vertex_index_t(), gCodom, vCodom));
+		}
+		for(const auto &perm : *perms) {
+			for(const std::size_t img : images) {
+				const std::size_t permuted = perm[img];
+				if(permuted < img) {
+					++numPruned;
+					return false;
+				}
+				if(permuted > img) break;
+			}
+		}
+		return true;
+	}
+
+	std::size_t getNumPruned() const {
+		return numPruned;
+	}
+private:
+	const Perms *perms;
+	mutable std::vector<std::size_t> images;
+	mutable std::size_t numPruned = 0;
+};
+
+// Whether the automorphisms of g can be used for pruning matches into it with the given settings.
+bool canUseHostSymmetry(const lib::Graph::Single &g, LabelSettings labelSettings);
+
+// Computes the lazily initialised data of g which is needed by makeHostSymmetry,
+// e.g., such that concurrent calls do not wait for each other on the first call.
+// pre: canUseHostSymmetry(g, labelSettings)
+void prepareHostSymmetry(const lib::Graph::Single &g, LabelSettings labelSettings);
+
+// The truncated automorphism group of g, see Graph::Single::getAutPerms.
+// The permutations are computed once per graph, so this is cheap after the first call.
+// pre: canUseHostSymmetry(g, labelSettings)
+HostSymmetry makeHostSymmetry(const lib::Graph::Single &g, LabelSettings labelSettings);
+
+} // namespace RC
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_RC_MATCH_MAKER_HOST_SYMMETRY_H */
@@ -8,6 +8,7 @@
 #include <mod/lib/IO/IO.hpp>
 #include <mod/lib/IO/Rule.hpp>
 #include <mod/lib/RC/MatchMaker/ComponentWiseUtil.hpp>
+#include <mod/lib/RC/MatchMaker/HostSymmetry.hpp>
 #include <mod/lib/RC/MatchMaker/LabelledMatch.hpp>
 #include <mod/lib/Rules/Properties/Term.hpp>
 #include <mod/lib/Term/WAM.hpp>
@@ -26,8 +27,11 @@ struct Super {
 	using VertexMapType = jla_boost::GraphMorphism::InvertibleVectorVertexMap<GraphDom, GraphCodom>;
 public:
 
-	Super(int verbosity, IO::Logger logger, bool allowPartial, bool enforceConstraints)
-			: verbosity(verbosity), logger(logger), allowPartial(allowPartial), enforceConstraints(enforceConstraints) {}
+	// With hostSymmetry given, matches which are not the smallest in their orbit are skipped.
+	Super(int verbosity, IO::Logger logger, bool allowPartial, bool enforceConstraints,
+	      const HostSymmetry *hostSymmetry = nullptr)
+			: verbosity(verbosity), logger(logger), allowPartial(allowPartial), enforceConstraints(enforceConstraints),
+			  hostSymmetry(hostSymmetry) {}
 
 	template<typename RFirst, typename RSecond, typename MR>
 	void makeMatches(const RFirst &rFirst, const RSecond &rSecond, MR &&mr, LabelSettings labelSettings) const {
@@ -102,6 +106,11 @@ private:
 				continue;
 			}
 			auto map = *std::move(maybeMap);
+			if(hostSymmetry && !hostSymmetry->isSmallestInOrbit(map, get_graph(lgDomPatterns), get_graph(lgCodomHosts))) {
+				if(verbosity >= V_MorphismGen)
+					IO::log() << "Super: match is not the smallest in its orbit." << std::endl;
+				continue;
+			}
 			bool continue_ = handleMapByLabelSettings(rFirst, rSecond, std::move(map), mr, labelSettings,
 																	verbosity, logger);
 			if(!continue_) break;
@@ -118,6 +127,7 @@ private:
 	mutable IO::Logger logger;
 	bool allowPartial;
 	bool enforceConstraints;
+	const HostSymmetry *hostSymmetry;
 };
 
 template<typename Position>
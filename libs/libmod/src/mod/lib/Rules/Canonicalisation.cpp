@@ -0,0 +1,131 @@
+#include "Canonicalisation.hpp"
+
+#include <mod/Error.hpp>
+#include <mod/lib/Rules/Real.hpp>
+#include <mod/lib/Rules/Properties/String.hpp>
+
+#include <graph_canon/aut/implicit_size_2.hpp>
+#include <graph_canon/aut/pruner_basic.hpp>
+#include <graph_canon/canonicalization.hpp>
+#include <graph_canon/edge_handler/all_equal.hpp>
+#include <graph_canon/invariant/cell_split.hpp>
+#include <graph_canon/invariant/partial_leaf.hpp>
+#include <graph_canon/invariant/quotient.hpp>
+#include <graph_canon/refine/WL_1.hpp>
+#include <graph_canon/refine/degree_1.hpp>
+#include <graph_canon/target_cell/flm.hpp>
+#include <graph_canon/tree_traversal/bfs-exp.hpp>
+
+#include <boost/graph/adjacency_list.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+namespace mod {
+namespace lib {
+namespace Rules {
+namespace {
+
+// The rule is canonicalised as a simple graph where each edge is subdivided by a new vertex,
+// such that the edge labels become vertex labels, and all edges are equal.
+using SubdividedGraph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
+
+struct VertexKey {
+	bool isEdge;
+	Membership membership;
+	std::string left, right;
+public:
+	friend bool operator<(const VertexKey &a, const VertexKey &b) {
+		return std::tie(a.isEdge, a.membership, a.left, a.right) < std::tie(b.isEdge, b.membership, b.left, b.right);
+	}
+};
+
+template<typename Labels>
+VertexKey makeKey(bool isEdge, Membership m, const Labels &labels) {
+	// the membership determines which sides are present
+	return VertexKey{isEdge, m, labels.first ? *labels.first : "", labels.second ? *labels.second : ""};
+}
+
+void writeLabel(std::ostream &s, const std::string &label) {
+	s << ' ' << label.size() << ':' << label;
+}
+
+} // namespace
+
+bool canCanonicalise(LabelType labelType, bool withStereo) {
+	return labelType == LabelType::String && !withStereo;
+}
+
+std::string getCanonForm(const Real &r, LabelType labelType, bool withStereo) {
+	if(labelType != LabelType::String)
+		throw LogicError("Can only canonicalise rules with label type string.");
+	if(withStereo)
+		throw LogicError("Can not canonicalise rules with stereo.");
+	const auto &rDPO = r.getDPORule();
+	const auto &core = get_graph(rDPO);
+	const auto &pString = get_string(rDPO);
+	const auto nCore = num_vertices(core);
+
+	SubdividedGraph g(nCore + num_edges(core));
+	std::vector<VertexKey> keys;
+	keys.reserve(num_vertices(g));
+	for(const auto v : asRange(vertices(core))) {
+		assert(get(boost::vertex_index_t(), core, v) == keys.size());
+		keys.push_back(makeKey(false, core[v].membership, pString[v]));
+	}
+	for(const auto e : asRange(edges(core))) {
+		const auto vE = keys.size();
+		keys.push_back(makeKey(true, core[e].membership, pString[e]));
+		add_edge(get(boost::vertex_index_t(), core, source(e, core)), vE, g);
+		add_edge(get(boost::vertex_index_t(), core, target(e, core)), vE, g);
+	}
+
+	std::vector<int> perm(num_vertices(g));
+	if(num_vertices(g) != 0) {
+		auto can = graph_canon::canonicalizer<int, graph_canon::edge_handler_all_equal, false, false>(
+				graph_canon::edge_handler_all_equal());
+		const auto idx = get(boost::vertex_index_t(), g);
+		const auto vis = graph_canon::make_visitor(
+				graph_canon::traversal_bfs_exp(), graph_canon::target_cell_flm(), graph_canon::refine_WL_1(),
+				graph_canon::aut_pruner_basic(), graph_canon::aut_implicit_size_2(), graph_canon::refine_degree_1(),
+				graph_canon::invariant_partial_leaf(), graph_canon::invariant_cell_split(), graph_canon::invariant_quotient()
+		);
+		const auto vLess = [&keys](std::size_t a, std::size_t b) {
+			return keys[a] < keys[b];
+		};
+		perm = can(g, idx, vLess, vis).first;
+	}
+
+	// perm[v] is the position of v in the canonical order
+	std::vector<std::size_t> order(perm.size());
+	for(std::size_t v = 0; v != perm.size(); ++v)
+		order[perm[v]] = v;
+	std::vector<std::pair<int, int> > canonEdges;
+	canonEdges.reserve(num_edges(g));
+	for(const auto e : asRange(edges(g))) {
+		int src = perm[source(e, g)];
+		int tar = perm[target(e, g)];
+		if(src > tar) std::swap(src, tar);
+		canonEdges.emplace_back(src, tar);
+	}
+	std::sort(canonEdges.begin(), canonEdges.end());
+
+	std::ostringstream s;
+	s << order.size() << ' ' << canonEdges.size() << '\n';
+	for(const auto v : order) {
+		const auto &key = keys[v];
+		s << (key.isEdge ? 'e' : 'v') << static_cast<int>(key.membership);
+		writeLabel(s, key.left);
+		writeLabel(s, key.right);
+		s << '\n';
+	}
+	for(const auto &e : canonEdges)
+		s << e.first << ' ' << e.second << '\n';
+	return s.str();
+}
+
+} // namespace Rules
+} // namespace lib
+} // namespace mod
@@ -0,0 +1,25 @@
+#ifndef MOD_LIB_RULES_CANONICALISATION_H
+#define MOD_LIB_RULES_CANONICALISATION_H
+
+#include <mod/Config.hpp>
+
+#include <string>
+
+namespace mod {
+namespace lib {
+namespace Rules {
+struct Real;
+
+// Whether getCanonForm can canonicalise rules with the given settings, instead of throwing an exception.
+bool canCanonicalise(LabelType labelType, bool withStereo);
+// A string encoding of the rule relabelled by a canonical vertex order.
+// It covers the membership and the left and right labels of all vertices and edges,
+// i.e., two rules have equal canonical forms if and only if they are isomorphic
+// in the sense of Real::isomorphism with the same settings. Match constraints are not included.
+std::string getCanonForm(const Real &r, LabelType labelType, bool withStereo);
+
+} // namespace Rules
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_RULES_CANONICALISATION_H */
@@ -1,6 +1,8 @@
 #ifndef MOD_LIB_RULES_GRAPHDECL_H
 #define MOD_LIB_RULES_GRAPHDECL_H
 
+#include <mod/lib/Arena.hpp>
+
 #include <jla_boost/graph/EdgeIndexedAdjacencyList.hpp>
 #include <jla_boost/graph/dpo/FilteredGraphProjection.hpp>
 #include <jla_boost/graph/dpo/Rule.hpp>
@@ -19,7 +21,10 @@ struct EProp {
 	Membership membership;
 };
 
-using GraphType = jla_boost::EdgeIndexedAdjacencyList<boost::undirectedS, VProp, EProp>;
+// the incidence lists are allocated from the current arena, if any,
+// such that the many short-lived intermediary rules during rule application avoid the heap
+using GraphType = jla_boost::EdgeIndexedAdjacencyList<boost::undirectedS, VProp, EProp, boost::no_property,
+		jla_boost::VecWithAllocatorS<ArenaAllocator> >;
 using Vertex = boost::graph_traits<GraphType>::vertex_descriptor;
 using Edge = boost::graph_traits<GraphType>::edge_descriptor;
 using SideGraphType = jla_boost::GraphDPO::FilteredGraphProjection<GraphType>;
@@ -52,7 +52,7 @@ LabelledRule::LabelledRule(const LabelledRule &other, bool withConstraints) : La
 			break;
 		}
 	}
-	if(other.pStereo) {
+	if(has_stereo(other)) {
 		const auto &lgLeft = get_labelled_left(other);
 		const auto &lgRight = get_labelled_right(other);
 		const auto infLeft = Stereo::makeCloner(lgLeft, get_left(*this), jla_boost::Identity(), jla_boost::Identity());
@@ -92,7 +92,7 @@ void LabelledRule::invert() {
 	if(pString) pString->invert();
 	if(pTerm) pTerm->invert();
 	if(pMolecule) pMolecule->invert();
-	if(pStereo) {
+	if(has_stereo(*this)) {
 		// TODO: this requires change all the offsets are recalculated
 		throw FatalError("Missing implementation of rule inversion with stereo info.");
 	}
@@ -103,6 +103,7 @@ void LabelledRule::invert() {
 	swap(this->leftMatchConstraints, this->rightMatchConstraints);
 	// clear cached stuff
 	this->projs.reset();
+	this->projsFlag.reset();
 }
 
 GraphType &get_graph(LabelledRule &r) {
@@ -120,21 +121,23 @@ const LabelledRule::PropStringType &get_string(const LabelledRule &r) {
 
 const LabelledRule::PropTermType &get_term(const LabelledRule &r) {
 	assert(r.pString || r.pTerm);
-	if(!r.pTerm) {
+	r.termFlag.callOnce([&r]() {
+		if(r.pTerm) return;
 		r.pTerm.reset(new LabelledRule::PropTermType(
 				get_graph(r), r.leftMatchConstraints, r.rightMatchConstraints,
 				get_string(r), lib::Term::getStrings()
 				));
-	}
+	});
 	return *r.pTerm;
 }
 
 bool has_stereo(const LabelledRule &r) {
-	return bool(r.pStereo);
+	return r.pStereo || r.stereoFlag.isDone();
 }
 
 const LabelledRule::PropStereoType &get_stereo(const LabelledRule &r) {
-	if(!has_stereo(r)) {
+	if(r.pStereo) return *r.pStereo;
+	r.stereoFlag.callOnce([&r]() {
 		auto gLeft = get_labelled_left(r);
 		auto gRight = get_labelled_right(r);
 		auto pMoleculeLeft = get_molecule(gLeft);
@@ -167,31 +170,37 @@ const LabelledRule::PropStereoType &get_stereo(const LabelledRule &r) {
 		case Stereo::DeductionResult::Error:
 			throw StereoDeductionError(ssErr.str());
 		}
-		r.pStereo.reset(new PropStereoCore(get_graph(r),
+		r.pStereoInferred.reset(new PropStereoCore(get_graph(r),
 				std::move(leftInference), std::move(rightInference), jla_boost::AlwaysTrue(), jla_boost::AlwaysTrue()));
-	}
-	return *r.pStereo;
+	});
+	return *r.pStereoInferred;
 }
 
 const LabelledRule::PropMoleculeType &get_molecule(const LabelledRule &r) {
-	if(!r.pMolecule) {
+	r.moleculeFlag.callOnce([&r]() {
 		r.pMolecule.reset(new LabelledRule::PropMoleculeType(get_graph(r), get_string(r)));
-	}
+	});
 	return *r.pMolecule;
 }
 
 const LabelledRule::LeftGraphType &get_left(const LabelledRule &r) {
-	if(!r.projs) r.projs.reset(new LabelledRule::Projections(r));
+	r.projsFlag.callOnce([&r]() {
+		r.projs.reset(new LabelledRule::Projections(r));
+	});
 	return r.projs->left;
 }
 
 const LabelledRule::ContextGraphType &get_context(const LabelledRule &r) {
-	if(!r.projs) r.projs.reset(new LabelledRule::Projections(r));
+	r.projsFlag.callOnce([&r]() {
+		r.projs.reset(new LabelledRule::Projections(r));
+	});
 	return r.projs->context;
 }
 
 const LabelledRule::RightGraphType &get_right(const LabelledRule &r) {
-	if(!r.projs) r.projs.reset(new LabelledRule::Projections(r));
+	r.projsFlag.callOnce([&r]() {
+		r.projs.reset(new LabelledRule::Projections(r));
+	});
 	return r.projs->right;
 }
 
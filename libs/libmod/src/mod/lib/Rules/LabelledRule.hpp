@@ -2,6 +2,7 @@
 #define MOD_LIB_RULES_LABELLED_RULE_H
 
 #include <mod/lib/GraphMorphism/Constraints/Constraint.hpp>
+#include <mod/lib/OnceFlag.hpp>
 #include <mod/lib/Rules/ConnectedComponent.hpp>
 #include <mod/lib/Rules/GraphDecl.hpp>
 #include <mod/lib/Rules/Properties/Molecule.hpp>
@@ -76,11 +77,15 @@ private:
 public:
 	mutable std::unique_ptr<PropStringType> pString;
 	mutable std::unique_ptr<PropTermType> pTerm;
-	mutable std::unique_ptr<PropStereoType> pStereo;
+	// the given stereo information, if any, otherwise get_stereo infers it
+	std::unique_ptr<PropStereoType> pStereo;
 	std::vector<std::unique_ptr<LeftMatchConstraint> > leftMatchConstraints;
 	std::vector<std::unique_ptr<RightMatchConstraint> >rightMatchConstraints;
 private:
+	mutable std::unique_ptr<PropStereoType> pStereoInferred;
 	mutable std::unique_ptr<PropMoleculeType> pMolecule;
+	// for concurrent initialisation of the lazily computed members
+	mutable OnceFlag projsFlag, termFlag, stereoFlag, moleculeFlag;
 public:
 	std::size_t numLeftComponents = -1, numRightComponents = -1;
 	std::vector<std::size_t> leftComponents, rightComponents;
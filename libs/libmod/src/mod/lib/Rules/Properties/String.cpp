@@ -81,8 +81,90 @@ PropStringCore::PropStringCore(const GraphType &g,
 	};
 	handleConstraints(leftMatchConstraints);
 	handleConstraints(rightMatchConstraints);
+	initIds();
+}
+
+void PropStringCore::invert() {
+	PropCore::invert();
+	using std::swap;
+	for(auto &ids : vertexIds) swap(ids.left, ids.right);
+	for(auto &ids : edgeIds) swap(ids.left, ids.right);
+}
+
+void PropStringCore::add(Vertex v, const std::string &valueLeft, const std::string &valueRight) {
+	PropCore::add(v, valueLeft, valueRight);
+	const auto &strings = getLabelStrings();
+	vertexIds.push_back({strings.getIndex(valueLeft), strings.getIndex(valueRight)});
+}
+
+void PropStringCore::add(Edge e, const std::string &valueLeft, const std::string &valueRight) {
+	PropCore::add(e, valueLeft, valueRight);
+	const auto &strings = getLabelStrings();
+	edgeIds.push_back({strings.getIndex(valueLeft), strings.getIndex(valueRight)});
+}
+
+void PropStringCore::setLeft(Vertex v, const std::string &value) {
+	PropCore::setLeft(v, value);
+	vertexIds[get(boost::vertex_index_t(), g, v)].left = getLabelStrings().getIndex(value);
+}
+
+void PropStringCore::setRight(Vertex v, const std::string &value) {
+	PropCore::setRight(v, value);
+	vertexIds[get(boost::vertex_index_t(), g, v)].right = getLabelStrings().getIndex(value);
+}
+
+void PropStringCore::setLeft(Edge e, const std::string &value) {
+	PropCore::setLeft(e, value);
+	edgeIds[get(boost::edge_index_t(), g, e)].left = getLabelStrings().getIndex(value);
+}
+
+void PropStringCore::setRight(Edge e, const std::string &value) {
+	PropCore::setRight(e, value);
+	edgeIds[get(boost::edge_index_t(), g, e)].right = getLabelStrings().getIndex(value);
+}
+
+std::size_t PropStringCore::getLeftId(Vertex v) const {
+	assert(g[v].membership != Membership::Right);
+	return vertexIds[get(boost::vertex_index_t(), g, v)].left;
+}
+
+std::size_t PropStringCore::getRightId(Vertex v) const {
+	assert(g[v].membership != Membership::Left);
+	return vertexIds[get(boost::vertex_index_t(), g, v)].right;
+}
+
+std::size_t PropStringCore::getLeftId(Edge e) const {
+	assert(g[e].membership != Membership::Right);
+	return edgeIds[get(boost::edge_index_t(), g, e)].left;
+}
+
+std::size_t PropStringCore::getRightId(Edge e) const {
+	assert(g[e].membership != Membership::Left);
+	return edgeIds[get(boost::edge_index_t(), g, e)].right;
+}
+
+std::pair<std::size_t, std::size_t> PropStringCore::getIds(Vertex v) const {
+	return {g[v].membership != Membership::Right ? getLeftId(v) : NoId,
+	        g[v].membership != Membership::Left ? getRightId(v) : NoId};
+}
+
+std::pair<std::size_t, std::size_t> PropStringCore::getIds(Edge e) const {
+	return {g[e].membership != Membership::Right ? getLeftId(e) : NoId,
+	        g[e].membership != Membership::Left ? getRightId(e) : NoId};
+}
+
+void PropStringCore::initIds() {
+	const auto &strings = getLabelStrings();
+	vertexIds.clear();
+	vertexIds.reserve(vertexState.size());
+	for(const auto &vs : vertexState)
+		vertexIds.push_back({strings.getIndex(vs.left), strings.getIndex(vs.right)});
+	edgeIds.clear();
+	edgeIds.reserve(edgeState.size());
+	for(const auto &es : edgeState)
+		edgeIds.push_back({strings.getIndex(es.left), strings.getIndex(es.right)});
 }
 
 } // namespace Rules
 } // namespace lib
-} // namespace mod
\ No newline at end of file
+} // namespace mod
@@ -5,14 +5,21 @@
 #include <mod/lib/Rules/GraphDecl.hpp>
 #include <mod/lib/Rules/Properties/Property.hpp>
 
+#include <limits>
+
 namespace mod {
 namespace lib {
 struct StringStore;
 namespace Rules {
 struct PropTermCore;
 
+// Besides the labels, the indices of the labels in getLabelStrings() are stored,
+// so they can be compared through the ids instead of as strings.
+// The modifying functions of PropCore are therefore replaced by versions which also maintain the ids.
 struct PropStringCore : PropCore<PropStringCore, GraphType, std::string, std::string> {
 	using ConstraintPtr = std::unique_ptr<GraphMorphism::Constraints::Constraint<SideGraphType> >;
+	// the id of a label on a side where the vertex or edge is not present
+	static constexpr std::size_t NoId = std::numeric_limits<std::size_t>::max();
 public:
 
 	explicit PropStringCore(const GraphType &g) : PropCore(g) {
@@ -23,10 +30,55 @@ public:
 			const std::vector<ConstraintPtr> &leftMatchConstraints,
 			const std::vector<ConstraintPtr> &rightMatchConstraints,
 			const PropTermCore &term, const StringStore &strings);
+	void invert();
+	void add(Vertex v, const std::string &valueLeft, const std::string &valueRight);
+	void add(Edge e, const std::string &valueLeft, const std::string &valueRight);
+	void setLeft(Vertex v, const std::string &value);
+	void setRight(Vertex v, const std::string &value);
+	void setLeft(Edge e, const std::string &value);
+	void setRight(Edge e, const std::string &value);
+	std::size_t getLeftId(Vertex v) const;
+	std::size_t getRightId(Vertex v) const;
+	std::size_t getLeftId(Edge e) const;
+	std::size_t getRightId(Edge e) const;
+	// both ids, with NoId for a side where the vertex or edge is not present
+	std::pair<std::size_t, std::size_t> getIds(Vertex v) const;
+	std::pair<std::size_t, std::size_t> getIds(Edge e) const;
+private:
+	void initIds();
+private:
+	struct Ids {
+		std::size_t left, right;
+	};
+	std::vector<Ids> vertexIds, edgeIds;
 };
 
+inline std::pair<std::size_t, std::size_t> get_label_id(const PropStringCore &p, Vertex v) {
+	return p.getIds(v);
+}
+
+inline std::pair<std::size_t, std::size_t> get_label_id(const PropStringCore &p, Edge e) {
+	return p.getIds(e);
+}
+
+inline std::size_t get_label_id(const PropStringCore::LeftType &p, Vertex v) {
+	return p.state.getDerived().getLeftId(v);
+}
+
+inline std::size_t get_label_id(const PropStringCore::LeftType &p, Edge e) {
+	return p.state.getDerived().getLeftId(e);
+}
+
+inline std::size_t get_label_id(const PropStringCore::RightType &p, Vertex v) {
+	return p.state.getDerived().getRightId(v);
+}
+
+inline std::size_t get_label_id(const PropStringCore::RightType &p, Edge e) {
+	return p.state.getDerived().getRightId(e);
+}
+
 } // namespace Rules
 } // namespace lib
 } // namespace mod
 
-#endif /* MOD_LIB_RULES_PROP_STRING_H */
\ No newline at end of file
+#endif /* MOD_LIB_RULES_PROP_STRING_H */
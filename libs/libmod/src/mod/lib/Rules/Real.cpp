@@ -21,6 +21,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <atomic>
+
 namespace mod {
 namespace lib {
 namespace Rules {
@@ -74,7 +76,8 @@ bool Real::sanityChecks(const GraphType &core, const PropStringCore &labelState,
 }
 
 namespace {
-std::size_t nextRuleNum = 0;
+// atomic as intermediary rules may be created concurrently during rule application
+std::atomic<std::size_t> nextRuleNum(0);
 } // namespace 
 
 Real::Real(LabelledRule &&rule, boost::optional<LabelType> labelType)
@@ -130,12 +133,16 @@ const lib::Rules::GraphType &Real::getGraph() const {
 }
 
 DepictionDataCore &Real::getDepictionData() {
-	if(!depictionData) depictionData.reset(new DepictionDataCore(getDPORule()));
+	depictionDataFlag.callOnce([this]() {
+		depictionData.reset(new DepictionDataCore(getDPORule()));
+	});
 	return *depictionData;
 }
 
 const DepictionDataCore &Real::getDepictionData() const {
-	if(!depictionData) depictionData.reset(new DepictionDataCore(getDPORule()));
+	depictionDataFlag.callOnce([this]() {
+		depictionData.reset(new DepictionDataCore(getDPORule()));
+	});
 	return *depictionData;
 }
 
@@ -157,6 +164,20 @@ bool Real::isOnlyRightSide() const {
 	return isOnlySide(Membership::Right);
 }
 
+const std::string &Real::getCanonForm(LabelType labelType, bool withStereo) const {
+	canonFormFlag.callOnce([&]() {
+		canonForm = std::make_unique<const std::string>(lib::Rules::getCanonForm(*this, labelType, withStereo));
+	});
+	return *canonForm;
+}
+
+std::size_t Real::getCanonHash(LabelType labelType, bool withStereo) const {
+	canonHashFlag.callOnce([&]() {
+		canonHash = std::hash<std::string>()(getCanonForm(labelType, withStereo));
+	});
+	return *canonHash;
+}
+
 const PropStringCore &Real::getStringState() const {
 	assert(dpoRule.pString || dpoRule.pTerm);
 	if(!dpoRule.pString) {
@@ -168,13 +189,7 @@ const PropStringCore &Real::getStringState() const {
 }
 
 const PropTermCore &Real::getTermState() const {
-	assert(dpoRule.pString || dpoRule.pTerm);
-	if(!dpoRule.pTerm) {
-		dpoRule.pTerm.reset(new PropTermCore(get_graph(dpoRule),
-		                                     dpoRule.leftMatchConstraints, dpoRule.rightMatchConstraints,
-		                                     getStringState(), lib::Term::getStrings()));
-	}
-	return *dpoRule.pTerm;
+	return get_term(dpoRule);
 }
 
 const PropMoleculeCore &Real::getMoleculeState() const {
@@ -228,6 +243,36 @@ bool Real::isomorphicLeftRight(const Real &rDom, const Real &rCodom, LabelSettin
 	return mrRight.getNumHits() == 1;
 }
 
+std::size_t Real::isomorphismInvariant(const Real &r, LabelType labelType) {
+	const auto &rDPO = r.getDPORule();
+	const auto &g = get_graph(rDPO);
+	const auto mix = [](std::size_t h) {
+		return h * 0x9E3779B97F4A7C15ull;
+	};
+	const auto labelHash = [labelType](const std::pair<std::size_t, std::size_t> &ids) {
+		// term labels are only equal up to variable renaming
+		if(labelType != LabelType::String) return std::size_t(0);
+		return ids.first ^ (ids.second * 31);
+	};
+	const auto &pString = get_string(rDPO);
+	// order-independent sums, so the vertex and edge order does not matter
+	std::size_t vSum = 0, eSum = 0;
+	for(const auto v : asRange(vertices(g))) {
+		const Membership m = membership(rDPO, v);
+		vSum += mix(static_cast<std::size_t>(m) + 1 + (labelHash(get_label_id(pString, v)) << 2));
+	}
+	for(const auto e : asRange(edges(g))) {
+		const Membership m = membership(rDPO, e);
+		eSum += mix(static_cast<std::size_t>(m) + 1 + (labelHash(get_label_id(pString, e)) << 2));
+	}
+	return num_vertices(g) ^ (num_edges(g) << 16) ^ vSum ^ (eSum * 31);
+}
+
+std::size_t Real::isomorphismHash(const Real &r, LabelType labelType, bool withStereo) {
+	if(canCanonicalise(labelType, withStereo)) return r.getCanonHash(labelType, withStereo);
+	else return isomorphismInvariant(r, labelType);
+}
+
 } // namespace Rules
 } // namespace lib
 } // namespace mod
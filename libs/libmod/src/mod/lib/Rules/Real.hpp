@@ -5,6 +5,8 @@
 #include <mod/Config.hpp>
 #include <mod/rule/ForwardDecl.hpp>
 #include <mod/lib/Graph/GraphDecl.hpp>
+#include <mod/lib/OnceFlag.hpp>
+#include <mod/lib/Rules/Canonicalisation.hpp>
 #include <mod/lib/Rules/LabelledRule.hpp>
 
 #include <jla_boost/graph/morphism/Predicates.hpp>
@@ -45,6 +47,10 @@ public:
 	bool isChemical() const;
 	bool isOnlySide(Membership membership) const;
 	bool isOnlyRightSide() const; // shortcut of above
+	// see Rules::getCanonForm for the requirements
+	const std::string &getCanonForm(LabelType labelType, bool withStereo) const;
+	// a hash of the canonical form
+	std::size_t getCanonHash(LabelType labelType, bool withStereo) const;
 public: // deprecated
 	const PropStringCore &getStringState() const;
 	const PropTermCore &getTermState() const;
@@ -61,6 +67,11 @@ public:
 	static bool isomorphicLeftRight(const Real &rDom,
 	                                const Real &rCodom,
 	                                LabelSettings labelSettings);
+	// A hash value which is equal for isomorphic rules under the given label type.
+	// Stereo information is not included.
+	static std::size_t isomorphismInvariant(const Real &r, LabelType labelType);
+	// The canonical hash if rules can be canonicalised with the given settings, and otherwise isomorphismInvariant.
+	static std::size_t isomorphismHash(const Real &r, LabelType labelType, bool withStereo);
 private:
 	const std::size_t id;
 	std::weak_ptr<rule::Rule> apiReference;
@@ -69,6 +80,11 @@ private:
 private:
 	LabelledRule dpoRule;
 	mutable std::unique_ptr<DepictionDataCore> depictionData;
+	// only string labels without stereo can be canonicalised, so there is a single form
+	mutable std::unique_ptr<const std::string> canonForm;
+	mutable boost::optional<std::size_t> canonHash;
+	// for concurrent initialisation of the lazily computed members
+	mutable OnceFlag depictionDataFlag, canonFormFlag, canonHashFlag;
 };
 
 struct LessById {
@@ -84,6 +100,10 @@ struct IsomorphismPredicate {
 			: settings(labelType, LabelRelation::Isomorphism, withStereo, LabelRelation::Isomorphism) {}
 
 	bool operator()(const Real *rDom, const Real *rCodom) const {
+		// the canonical forms are cached, so repeated comparisons are cheap
+		if(canCanonicalise(settings.type, settings.withStereo))
+			return rDom->getCanonForm(settings.type, settings.withStereo)
+			       == rCodom->getCanonForm(settings.type, settings.withStereo);
 		return 1 == Real::isomorphism(*rDom, *rCodom, 1, settings);
 	}
 
@@ -0,0 +1,21 @@
+#ifndef MOD_LIB_STOPWATCH_H
+#define MOD_LIB_STOPWATCH_H
+
+#include <chrono>
+
+namespace mod {
+namespace lib {
+
+// Measures wall-clock time from construction.
+struct Stopwatch {
+	double seconds() const {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+private:
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_STOPWATCH_H */
@@ -1,43 +1,99 @@
 #include "StringStore.hpp"
 
+#include <mod/Error.hpp>
+
 #include <cassert>
-#include <iostream>
+#include <functional>
 
 namespace mod {
 namespace lib {
 
+StringStore::Table::Table(std::size_t capacity) : mask(capacity - 1), slots(new std::atomic<std::size_t>[capacity]) {
+	assert((capacity & mask) == 0);
+	for(std::size_t i = 0; i != capacity; ++i)
+		slots[i].store(0, std::memory_order_relaxed);
+}
+
+StringStore::StringStore() {
+	tables.push_back(std::make_unique<Table>(InitialCapacity));
+	table.store(tables.back().get(), std::memory_order_release);
+}
+
+StringStore::~StringStore() = default;
+
 bool StringStore::hasString(const std::string &s) const {
-	return index.find(s) != end(index);
+	const std::size_t hash = std::hash<std::string>()(s);
+	if(find(*table.load(std::memory_order_acquire), s, hash) != NotFound) return true;
+	// the string may have been inserted into a newer table in the meantime
+	std::lock_guard<std::mutex> lock(mtx);
+	return find(*table.load(std::memory_order_relaxed), s, hash) != NotFound;
 }
 
 std::size_t StringStore::getIndex(const std::string &s) const {
+	const std::size_t hash = std::hash<std::string>()(s);
+	{
+		const std::size_t index = find(*table.load(std::memory_order_acquire), s, hash);
+		if(index != NotFound) return index;
+	}
+	std::lock_guard<std::mutex> lock(mtx);
+	Table *t = table.load(std::memory_order_relaxed);
+	{
+		const std::size_t index = find(*t, s, hash);
+		if(index != NotFound) return index;
+	}
+	const std::size_t index = numStrings.load(std::memory_order_relaxed);
+	if(index == ChunkSize * MaxChunks)
+		throw FatalError("StringStore is full, with " + std::to_string(index) + " strings.");
+	auto &chunk = chunks[index >> ChunkBits];
+	if(!chunk) chunk.reset(new Entry[ChunkSize]);
+	chunk[index & (ChunkSize - 1)] = Entry{s, hash};
+	numStrings.store(index + 1, std::memory_order_release);
+	// keep the load factor at most 1/2
+	if(2 * (index + 1) > t->mask + 1) {
+		tables.push_back(std::make_unique<Table>(2 * (t->mask + 1)));
+		t = tables.back().get();
+		for(std::size_t i = 0; i != index; ++i)
+			insert(*t, i, getEntry(i).hash);
+		table.store(t, std::memory_order_release);
+	}
+	// the entry is published to lock-free readers along with the slot
+	insert(*t, index, hash);
+	return index;
+}
 
-	struct DoPrint {
+const std::string &StringStore::getString(std::size_t index) const {
+	return getEntry(index).str;
+}
 
-		DoPrint(const StringStore &store, const std::string &s) : store(store), s(s) { }
+std::size_t StringStore::size() const {
+	return numStrings.load(std::memory_order_acquire);
+}
 
-		~DoPrint() {
-			std::cout << "StringStore getIndex(" << s << ")" << std::endl;
-			std::cout << "================================================" << std::endl;
-			for(const auto &p : store.index) {
-				assert(p.second < store.strings.size());
-				assert(store.strings[p.second] == p.first);
-				std::cout << "\t" << p.second << " -> " << p.first << std::endl;
-			}
-		}
-	private:
-		const StringStore &store;
-		const std::string &s;
-	} /*doPrint(*this, s)*/;
-	auto pIter = index.emplace(s, strings.size());
-	if(pIter.second) strings.push_back(s);
-	return pIter.first->second;
+const StringStore::Entry &StringStore::getEntry(std::size_t index) const {
+	assert(index < numStrings.load(std::memory_order_acquire));
+	return chunks[index >> ChunkBits][index & (ChunkSize - 1)];
 }
 
-const std::string &StringStore::getString(std::size_t index) const {
-	assert(index < strings.size());
-	return strings[index];
+std::size_t StringStore::find(const Table &table, const std::string &s, std::size_t hash) const {
+	for(std::size_t pos = hash & table.mask;; pos = (pos + 1) & table.mask) {
+		const std::size_t slot = table.slots[pos].load(std::memory_order_acquire);
+		if(slot == 0) return NotFound;
+		const Entry &entry = getEntry(slot - 1);
+		if(entry.hash == hash && entry.str == s) return slot - 1;
+	}
+}
+
+void StringStore::insert(Table &table, std::size_t index, std::size_t hash) const {
+	std::size_t pos = hash & table.mask;
+	while(table.slots[pos].load(std::memory_order_relaxed) != 0)
+		pos = (pos + 1) & table.mask;
+	table.slots[pos].store(index + 1, std::memory_order_release);
+}
+
+const StringStore &getLabelStrings() {
+	static StringStore strings;
+	return strings;
 }
 
 } // namespace lib
-} // namespace mod
\ No newline at end of file
+} // namespace mod
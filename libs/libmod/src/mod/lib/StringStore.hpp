@@ -1,28 +1,74 @@
 #ifndef MOD_LIB_STRINGSTORE_H
 #define	MOD_LIB_STRINGSTORE_H
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 namespace mod {
 namespace lib {
 
+// Interns strings, i.e., maps each distinct string to a dense index.
+// Indices are never reused and the strings never move, so references from getString stay valid.
+// All functions may be called concurrently. Only the insertion of a new string locks,
+// lookups go through an open addressing hash table which is read without locking.
 struct StringStore {
-	StringStore() = default;
+	StringStore();
+	~StringStore();
 	StringStore(const StringStore&) = delete;
 	StringStore(StringStore&&) = delete;
 	StringStore &operator=(const StringStore&) = delete;
 	StringStore &operator=(StringStore&&) = delete;
 	bool hasString(const std::string &s) const;
 	std::size_t getIndex(const std::string &s) const;
+	// pre: index has been returned by getIndex
 	const std::string &getString(std::size_t index) const;
+	std::size_t size() const;
 private:
-	mutable std::vector<std::string> strings;
-	mutable std::map<std::string, std::size_t> index;
+	struct Entry {
+		std::string str;
+		std::size_t hash;
+	};
+
+	// Each slot holds 1 + the index of a string, or 0 when empty.
+	// A table is replaced by a larger one instead of being resized,
+	// and the old tables are kept until destruction as readers may still probe them.
+	struct Table {
+		explicit Table(std::size_t capacity);
+	public:
+		const std::size_t mask;
+		const std::unique_ptr<std::atomic<std::size_t>[]> slots;
+	};
+private:
+	const Entry &getEntry(std::size_t index) const;
+	// returns NotFound if s is not in the table
+	std::size_t find(const Table &table, const std::string &s, std::size_t hash) const;
+	// pre: mtx is held and there is room in the table
+	void insert(Table &table, std::size_t index, std::size_t hash) const;
+private:
+	static constexpr std::size_t ChunkBits = 12;
+	static constexpr std::size_t ChunkSize = std::size_t(1) << ChunkBits;
+	static constexpr std::size_t MaxChunks = std::size_t(1) << 12;
+	static constexpr std::size_t InitialCapacity = 1024;
+	static constexpr std::size_t NotFound = -1;
+private:
+	mutable std::mutex mtx;
+	// chunks are only ever added, and only while holding mtx
+	mutable std::array<std::unique_ptr<Entry[]>, MaxChunks> chunks;
+	mutable std::atomic<std::size_t> numStrings{0};
+	mutable std::atomic<Table*> table;
+	// all tables ever used, only modified while holding mtx
+	mutable std::vector<std::unique_ptr<Table> > tables;
 };
 
+// The store for the labels of string-labelled graphs and rules,
+// such that two labels are equal if and only if their indices are equal.
+const StringStore &getLabelStrings();
+
 } // namespace lib
 } // namespace mod
 
-#endif	/* MOD_LIB_STRINGSTORE_H */
\ No newline at end of file
+#endif	/* MOD_LIB_STRINGSTORE_H */
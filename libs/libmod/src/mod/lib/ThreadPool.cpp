@@ -0,0 +1,152 @@
+#include "ThreadPool.hpp"
+
+#include <mod/Config.hpp>
+#include <mod/lib/Graph/IsomorphismCallCounter.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+
+namespace mod {
+namespace lib {
+namespace {
+thread_local bool inTask = false;
+
+struct TaskScope {
+	TaskScope() : wasInTask(inTask) {
+		inTask = true;
+	}
+
+	~TaskScope() {
+		inTask = wasInTask;
+	}
+private:
+	const bool wasInTask;
+};
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned int numThreads) : next(0), failed(false) {
+	numThreads = std::max(1u, numThreads);
+	workers.reserve(numThreads - 1);
+	for(unsigned int i = 1; i < numThreads; ++i)
+		workers.emplace_back([this]() {
+			workerMain();
+		});
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		stop = true;
+	}
+	cvStart.notify_all();
+	for(auto &t : workers) t.join();
+}
+
+unsigned int ThreadPool::getNumThreads() const {
+	return workers.size() + 1;
+}
+
+void ThreadPool::forEach(std::size_t n, const std::function<void(std::size_t)> &f) {
+	if(n == 0) return;
+	if(workers.empty() || n == 1) {
+		TaskScope scope;
+		for(std::size_t i = 0; i != n; ++i) f(i);
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		assert(numActive == 0);
+		this->f = &f;
+		this->n = n;
+		next = 0;
+		failed = false;
+		error = nullptr;
+		numActive = workers.size();
+		++generation;
+	}
+	cvStart.notify_all();
+	work();
+	std::exception_ptr e;
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+		cvDone.wait(lock, [this]() {
+			return numActive == 0;
+		});
+		this->f = nullptr;
+		std::swap(e, error);
+	}
+	if(e) std::rethrow_exception(e);
+}
+
+void ThreadPool::workerMain() {
+	std::size_t seenGeneration = 0;
+	while(true) {
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			cvStart.wait(lock, [&]() {
+				return stop || generation != seenGeneration;
+			});
+			if(stop) return;
+			seenGeneration = generation;
+		}
+		work();
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			--numActive;
+			if(numActive == 0) cvDone.notify_one();
+		}
+	}
+}
+
+void ThreadPool::work() {
+	TaskScope scope;
+	while(!failed) {
+		const std::size_t i = next++;
+		if(i >= n) break;
+		try {
+			(*f)(i);
+		} catch(...) {
+			std::lock_guard<std::mutex> lock(mtx);
+			if(!error) error = std::current_exception();
+			failed = true;
+		}
+	}
+}
+
+namespace {
+
+std::atomic<bool> globalPoolBusy(false);
+std::unique_ptr<ThreadPool> globalPool;
+
+} // namespace
+
+void parallelForEach(std::size_t n, const std::function<void(std::size_t)> &f) {
+	const unsigned int numThreads = getConfig().common.numThreads.get();
+	bool expected = false;
+	if(numThreads <= 1 || n <= 1 || inTask || !globalPoolBusy.compare_exchange_strong(expected, true)) {
+		for(std::size_t i = 0; i != n; ++i) f(i);
+		return;
+	}
+	struct Release {
+		~Release() {
+			globalPoolBusy = false;
+		}
+	} release;
+	if(!globalPool || globalPool->getNumThreads() != numThreads)
+		globalPool = std::make_unique<ThreadPool>(numThreads);
+	// the tasks count their isomorphism calls on behalf of the calling thread
+	Graph::IsomorphismCallCounter *const counter = Graph::IsomorphismCallCounter::getCurrent();
+	globalPool->forEach(n, [&f, counter](std::size_t i) {
+		Graph::IsomorphismCallCounter::Inherit inherit(counter);
+		f(i);
+	});
+}
+
+bool isInParallelTask() {
+	return inTask;
+}
+
+} // namespace lib
+} // namespace mod
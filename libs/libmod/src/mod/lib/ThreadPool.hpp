@@ -0,0 +1,58 @@
+#ifndef MOD_LIB_THREADPOOL_H
+#define MOD_LIB_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mod {
+namespace lib {
+
+// A fixed set of worker threads for data-parallel loops.
+// The calling thread participates in the work, so a pool of n threads has n - 1 workers.
+struct ThreadPool {
+	explicit ThreadPool(unsigned int numThreads);
+	ThreadPool(const ThreadPool &) = delete;
+	ThreadPool &operator=(const ThreadPool &) = delete;
+	~ThreadPool();
+	unsigned int getNumThreads() const;
+	// Calls f(i) for all i in [0, n), with indices handed out dynamically to the threads.
+	// The first exception thrown by a task is rethrown in the calling thread after all threads are idle.
+	// Not reentrant: at most one thread may be inside forEach at a time.
+	void forEach(std::size_t n, const std::function<void(std::size_t)> &f);
+private:
+	void workerMain();
+	void work();
+private:
+	std::vector<std::thread> workers;
+	std::mutex mtx;
+	std::condition_variable cvStart, cvDone;
+	std::size_t generation = 0;
+	unsigned int numActive = 0;
+	bool stop = false;
+private: // the current job
+	const std::function<void(std::size_t)> *f = nullptr;
+	std::size_t n = 0;
+	std::atomic<std::size_t> next;
+	std::atomic<bool> failed;
+	std::exception_ptr error;
+};
+
+// Calls f(i) for all i in [0, n) using the library-wide pool, sized by getConfig().common.numThreads.
+// The loop is executed serially in the calling thread if only a single thread is configured,
+// if the pool is already busy (e.g., on nested calls from within a task), or if n <= 1.
+// The tasks inherit the Graph::IsomorphismCallCounter of the calling thread.
+void parallelForEach(std::size_t n, const std::function<void(std::size_t)> &f);
+
+// True iff the calling thread is currently executing a task from parallelForEach.
+bool isInParallelTask();
+
+} // namespace lib
+} // namespace mod
+
+#endif /* MOD_LIB_THREADPOOL_H */
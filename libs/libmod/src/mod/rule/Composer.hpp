@@ -50,6 +50,10 @@ public:
 	// rst:		- 10: Print information about morphism generation for rule composition.
 	// rst:		- 20: Print rule composition information.
 	// rst:
+	// rst:		If ``config.common.numThreads`` is larger than 1 and nothing is printed, then the compositions
+	// rst:		are computed using that many threads. The resulting rules are the same as with a single thread,
+	// rst:		but the IDs, and thereby the default names, of new rules may differ.
+	// rst:
 	// rst:		:returns: the result of the expression.
 	std::unordered_set<std::shared_ptr<Rule>> eval(const RCExp::Expression &exp, int verbosity);
 	// rst: .. function:: void print() const
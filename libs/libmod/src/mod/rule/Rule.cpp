@@ -164,6 +164,15 @@ void checkTermParsing(const lib::Rules::Real &r, LabelSettings ls) {
 std::size_t Rule::isomorphism(std::shared_ptr<Rule> r, std::size_t maxNumMatches, LabelSettings labelSettings) const {
 	checkTermParsing(this->getRule(), labelSettings);
 	checkTermParsing(r->getRule(), labelSettings);
+	// as for graphs, a single isomorphism may be settled by comparing canonical forms
+	const bool useCanon = maxNumMatches == 1
+			&& getConfig().graph.isomorphismAlg.get() == Config::IsomorphismAlg::Canon
+			&& labelSettings.relation == LabelRelation::Isomorphism
+			&& (!labelSettings.withStereo || labelSettings.stereoRelation == LabelRelation::Isomorphism);
+	if(useCanon) {
+		const auto isomorphic = lib::Rules::makeIsomorphismPredicate(labelSettings.type, labelSettings.withStereo);
+		return isomorphic(&this->getRule(), &r->getRule()) ? 1 : 0;
+	}
 	return lib::Rules::Real::isomorphism(this->getRule(), r->getRule(), maxNumMatches, labelSettings);
 }
 
@@ -138,6 +138,9 @@ public:
 	// rst: .. function:: std::size_t isomorphism(std::shared_ptr<Rule> r, std::size_t maxNumMatches, LabelSettings labelSettings) const
 	// rst:
 	// rst:		:returns: the number of isomorphisms found between `r` and this graph, but at most `maxNumMatches`.
+	// rst:
+	// rst:		With ``maxNumMatches`` being 1, isomorphism label relations, and ``config.graph.isomorphismAlg``
+	// rst:		set to ``Canon``, the rules are compared by their canonical forms when possible.
 	std::size_t isomorphism(std::shared_ptr<Rule> r, std::size_t maxNumMatches, LabelSettings labelSettings) const;
 	// rst: .. function:: std::size_t monomorphism(std::shared_ptr<Rule> r, std::size_t maxNumMatches, LabelSettings labelSettings) const
 	// rst:
@@ -306,17 +306,23 @@ class DGBuildContextManager(object):
 		self._check()
 		return self._builder.addDerivation(d, graphPolicy)
 
-	def execute(self, strategy, *, verbosity=2, ignoreRuleLabelTypes=False):
+	def execute(self, strategy, *, verbosity=2, ignoreRuleLabelTypes=False,
+			engine=DGRuleApplicationEngine.Composition):
 		self._check()
-		return self._builder.execute(dgStrat(strategy), verbosity, ignoreRuleLabelTypes)
+		return self._builder.execute(dgStrat(strategy), verbosity, ignoreRuleLabelTypes, engine)
 
 	def addAbstract(self, description):
 		self._check()
 		return self._builder.addAbstract(description)
+
+	def load(self, ruleDatabase, file, verbosity=2):
+		self._check()
+		return self._builder.load(_wrap(VecRule, ruleDatabase), prefixFilename(file), verbosity)
 	
 _DG_build_orig = DG.build
 DG.build = lambda self: DGBuildContextManager(self)
 
+DGRuleApplicationEngine.__str__ = libpymod._DGRuleApplicationEngine__str__
 
 #----------------------------------------------------------
 # DGExecuteResult
@@ -413,6 +419,11 @@ def _DGStrat_makeFilter(alsoUniverse, filterFunc):
 	return _DGStrat_makeFilter_orig(alsoUniverse, _funcWrap(Func_BoolGraphDGStratGraphStateBool, filterFunc))
 DGStrat.makeFilter = _DGStrat_makeFilter
 
+_DGStrat_makeFilterBatch_orig = DGStrat.makeFilterBatch
+def _DGStrat_makeFilterBatch(alsoUniverse, filterFunc):
+	return _DGStrat_makeFilterBatch_orig(alsoUniverse, _funcWrap(Func_VecBoolVecGraphDGStratGraphState, filterFunc))
+DGStrat.makeFilterBatch = _DGStrat_makeFilterBatch
+
 _DGStrat_makeLeftPredicate_orig = DGStrat.makeLeftPredicate
 def _DGStrat_makeLeftPredicate(pred, strat):
 	return _DGStrat_makeLeftPredicate_orig(_funcWrap(Func_BoolDerivation, pred), strat)
@@ -438,6 +449,11 @@ def _DGStrat_makeSort(doUniverse, less):
 	return _DGStrat_makeSort_orig(doUniverse, _funcWrap(Func_BoolGraphGraphDGStratGraphState, less))
 DGStrat.makeSort = _DGStrat_makeSort
 
+_DGStrat_makeSortByKey_orig = DGStrat.makeSortByKey
+def _DGStrat_makeSortByKey(doUniverse, key):
+	return _DGStrat_makeSortByKey_orig(doUniverse, _funcWrap(Func_DoubleGraph, key))
+DGStrat.makeSortByKey = _DGStrat_makeSortByKey
+
 
 #----------------------------------------------------------
 # Graph
@@ -482,6 +498,24 @@ def graphDFS(s, name=None, add=True):
 def smiles(s, name=None, add=True):
 	return _graphLoad(libpymod.smiles(s), name, add)
 
+def precomputeGraphs(graphs, labelSettings=LabelSettings(LabelType.String, LabelRelation.Isomorphism)):
+	return libpymod.precomputeGraphs(_wrap(VecGraph, graphs), labelSettings)
+def canonicaliseGraphs(graphs):
+	return libpymod.canonicaliseGraphs(_wrap(VecGraph, graphs))
+
+def _lazyGraphLoad(a, name):
+	if name != None:
+		a.name = name
+	return a
+def lazyGraphGMLString(d, name=None):
+	return _lazyGraphLoad(libpymod.lazyGraphGMLString(d), name)
+def lazyGraphGML(f, name=None):
+	return _lazyGraphLoad(libpymod.lazyGraphGML(prefixFilename(f)), name)
+def lazyGraphDFS(s, name=None):
+	return _lazyGraphLoad(libpymod.lazyGraphDFS(s), name)
+def lazySmiles(s, name=None):
+	return _lazyGraphLoad(libpymod.lazySmiles(s), name)
+
 Graph.__repr__ = lambda self: str(self) + "(" + str(self.id) + ")"
 Graph.__eq__ = lambda self, other: self.id == other.id
 Graph.__lt__ = lambda self, other: self.id < other.id
@@ -575,14 +609,16 @@ def dgStrat(s):
 # add
 #----------------------------------------------------------
 
-def _DGStrat_add(doUniverse, g, gs, graphPolicy):
+def _DGStrat_add(doUniverse, g, gs, graphPolicy, rules):
 	if hasattr(g, "__call__"): # assume the dynamic version is meant
 		if len(gs) > 0:
 			raise TypeError("The dynamic version of addSubset/addUniverse takes exactly 1 argument (" + str(len(gs) + 1) + " given).")
+		if rules is not None:
+			raise TypeError("The dynamic version of addSubset/addUniverse does not take rules.")
 		return DGStrat.makeAddDynamic(doUniverse, g, graphPolicy)
 	else: # assume the static version was meant
 		def convertGraphs(graphs, g):
-			if isinstance(g, Graph):
+			if isinstance(g, (Graph, LazyGraph)):
 				graphs.append(g)
 			else:
 				graphs.extend(a for a in g)
@@ -590,11 +626,19 @@ def _DGStrat_add(doUniverse, g, gs, graphPolicy):
 		convertGraphs(graphs, g)
 		for a in gs:
 			convertGraphs(graphs, a)
+		if any(isinstance(a, LazyGraph) for a in graphs):
+			if not all(isinstance(a, LazyGraph) for a in graphs):
+				raise TypeError("Can not mix Graph and LazyGraph in addSubset/addUniverse.")
+			if rules is None:
+				rules = []
+			return DGStrat.makeAddLazy(doUniverse, _wrap(VecLazyGraph, graphs), _wrap(VecRule, rules), graphPolicy)
+		if rules is not None:
+			raise TypeError("Only addSubset/addUniverse with lazy graphs take rules.")
 		return DGStrat.makeAddStatic(doUniverse, graphs, graphPolicy)
-def addUniverse(g, *gs, graphPolicy=IsomorphismPolicy.Check):
-	return _DGStrat_add(True, g, gs, graphPolicy)
-def addSubset(g, *gs, graphPolicy=IsomorphismPolicy.Check):
-	return _DGStrat_add(False, g, gs, graphPolicy)
+def addUniverse(g, *gs, graphPolicy=IsomorphismPolicy.Check, rules=None):
+	return _DGStrat_add(True, g, gs, graphPolicy, rules)
+def addSubset(g, *gs, graphPolicy=IsomorphismPolicy.Check, rules=None):
+	return _DGStrat_add(False, g, gs, graphPolicy, rules)
 
 # derivation predicates
 #----------------------------------------------------------
@@ -627,13 +671,19 @@ execute = lambda func: DGStrat.makeExecute(func)
 #----------------------------------------------------------
 
 class _DGStrat_FilterProxy(object):
-	def __init__(self, alsoUniverse):
+	def __init__(self, alsoUniverse, batch=False):
 		self.alsoUniverse = alsoUniverse
+		self.batch = batch
 	def __call__(self, filterFunc):
-		return DGStrat.makeFilter(self.alsoUniverse, filterFunc)
+		if self.batch:
+			return DGStrat.makeFilterBatch(self.alsoUniverse, filterFunc)
+		else:
+			return DGStrat.makeFilter(self.alsoUniverse, filterFunc)
 
 filterUniverse = _DGStrat_FilterProxy(True)
 filterSubset = _DGStrat_FilterProxy(False)
+filterUniverseBatch = _DGStrat_FilterProxy(True, batch=True)
+filterSubsetBatch = _DGStrat_FilterProxy(False, batch=True)
 
 # repeat
 #----------------------------------------------------------
@@ -686,13 +736,19 @@ Rule.__rshift__ = _DGStrat_sequence__rshift__
 #----------------------------------------------------------
 
 class _DGStrat_SortProxy(object):
-	def __init__(self, doUniverse):
+	def __init__(self, doUniverse, byKey=False):
 		self.doUniverse = doUniverse
-	def __call__(self, less):
-		return DGStrat.makeSort(self.doUniverse, less)
+		self.byKey = byKey
+	def __call__(self, f):
+		if self.byKey:
+			return DGStrat.makeSortByKey(self.doUniverse, f)
+		else:
+			return DGStrat.makeSort(self.doUniverse, f)
 
 sortSubset = _DGStrat_SortProxy(False)
 sortUniverse = _DGStrat_SortProxy(True)
+sortSubsetByKey = _DGStrat_SortProxy(False, byKey=True)
+sortUniverseByKey = _DGStrat_SortProxy(True, byKey=True)
 
 # take
 #----------------------------------------------------------
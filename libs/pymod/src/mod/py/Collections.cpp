@@ -5,6 +5,7 @@
 #include <mod/dg/GraphInterface.hpp>
 #include <mod/dg/Strategies.hpp>
 #include <mod/graph/Graph.hpp>
+#include <mod/graph/LazyGraph.hpp>
 #include <mod/rule/CompositionExpr.hpp>
 #include <mod/rule/Rule.hpp>
 
@@ -82,6 +83,7 @@ void Collections_doExport() {
 	makeVector(VecDGHyperEdge, dg::DG::HyperEdge);
 	makeVector(VecDGStrat, std::shared_ptr<dg::Strategy>);
 	makeVector(VecGraph, std::shared_ptr<graph::Graph>);
+	makeVector(VecLazyGraph, std::shared_ptr<graph::LazyGraph>);
 	makeVector(VecRule, std::shared_ptr<rule::Rule>);
 	using PairString = std::pair<std::string, std::string>;
 	makeVector(VecPairString, PairString);
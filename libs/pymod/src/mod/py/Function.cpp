@@ -26,6 +26,7 @@ void Function_doExport() {
 	// Graph -> X
 	exportFunc<bool(std::shared_ptr<graph::Graph>)>("Func_BoolGraph");
 	exportFunc<int(std::shared_ptr<graph::Graph>)>("Func_IntGraph");
+	exportFunc<double(std::shared_ptr<graph::Graph>)>("Func_DoubleGraph");
 	exportFunc < std::string(std::shared_ptr<graph::Graph>)>("Func_StringGraph");
 	// Graph x DG -> X
 	exportFunc < bool(std::shared_ptr<graph::Graph>, std::shared_ptr<dg::DG>)>("Func_BoolGraphDG");
@@ -38,6 +39,8 @@ void Function_doExport() {
 	exportFunc<bool(std::shared_ptr<graph::Graph>, const dg::Strategy::GraphState&, bool)>("Func_BoolGraphDGStratGraphStateBool");
 	// Graph x Graph x Strategy::GraphState -> X
 	exportFunc<bool(std::shared_ptr<graph::Graph>, std::shared_ptr<graph::Graph>, const dg::Strategy::GraphState&)>("Func_BoolGraphGraphDGStratGraphState");
+	// [Graph] x Strategy::GraphState -> X
+	exportFunc<std::vector<bool>(const std::vector<std::shared_ptr<graph::Graph> >&, const dg::Strategy::GraphState&)>("Func_VecBoolVecGraphDGStratGraphState");
 	// Strategy::GraphState -> X
 	exportFunc<void(const dg::Strategy::GraphState&)>("Func_VoidDGStratGraphState");
 }
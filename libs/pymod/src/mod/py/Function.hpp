@@ -4,8 +4,10 @@
 // The wrapping and haxing of reference counts could probably be done simpler.
 // The arg wrapping should also be looked into.
 // Use exportFunc to export the wrapper class for a given signature.
+// The wrapper may be called from any thread while the GIL is released, see GIL.hpp.
 
 #include <mod/Function.hpp>
+#include <mod/py/GIL.hpp>
 
 #include <boost/python.hpp>
 
@@ -39,6 +41,33 @@ struct Returner {
 	}
 };
 
+// the returned graphs may hold references to their Python objects
+template<typename T>
+struct Returner<std::vector<std::shared_ptr<T> > > {
+
+	static std::vector<std::shared_ptr<T> > doReturn(decltype((*static_cast<py::override*> (nullptr))()) r) {
+		std::vector<std::shared_ptr<T> > res = r;
+		return withGILDeleter(std::move(res));
+	}
+};
+
+// any iterable of truth values is accepted, e.g., a list or a NumPy array
+template<>
+struct Returner<std::vector<bool> > {
+
+	static std::vector<bool> doReturn(decltype((*static_cast<py::override*> (nullptr))()) r) {
+		py::object o = r;
+		std::vector<bool> res;
+		for(py::stl_input_iterator<py::object> iter(o), end; iter != end; ++iter) {
+			const py::object item = *iter;
+			const int b = PyObject_IsTrue(item.ptr());
+			if(b < 0) py::throw_error_already_set();
+			res.push_back(b != 0);
+		}
+		return res;
+	}
+};
+
 template<>
 struct Returner<void> {
 
@@ -53,33 +82,48 @@ template<typename R, typename ...Args>
 struct FunctionWrapper<R(Args...)> : mod::Function<R(Args...)>, py::wrapper<FunctionWrapper<R(Args...)> > {
 
 	std::shared_ptr < mod::Function < R(Args...)> > clone() const {
-		if(py::override f = this->get_override("clone")) {
-			return f();
-		} else {
-			print(std::cerr << "ERROR: override of 'clone' not found in Function\n");
-			std::cerr << std::endl;
-			std::exit(1);
+		AcquireGIL gil;
+		try {
+			if(py::override f = this->get_override("clone")) {
+				std::shared_ptr < mod::Function < R(Args...)> > res = f();
+				// the clone holds a reference to its Python object, which may be released without the GIL
+				return withGILDeleter(std::move(res));
+			}
+		} catch(const py::error_already_set &) {
+			throw PythonError();
 		}
+		print(std::cerr << "ERROR: override of 'clone' not found in Function\n");
+		std::cerr << std::endl;
+		std::exit(1);
 	}
 
 	void print(std::ostream &s) const {
-		if(py::override f = this->get_override("__str__")) {
-			std::string str = f();
-			s << str;
-		} else {
-			std::cerr << "ERROR: override of '__str__' not found in Function" << std::endl;
-			std::exit(1);
+		AcquireGIL gil;
+		try {
+			if(py::override f = this->get_override("__str__")) {
+				std::string str = f();
+				s << str;
+				return;
+			}
+		} catch(const py::error_already_set &) {
+			throw PythonError();
 		}
+		std::cerr << "ERROR: override of '__str__' not found in Function" << std::endl;
+		std::exit(1);
 	}
 
 	R operator()(Args ...args) const {
-		if(py::override f = this->get_override("__call__")) {
-			return Returner<R>::doReturn(f(ArgWrap<Args>::wrap(args)...));
-		} else {
-			print(std::cerr << "ERROR: override of '__call__' not found in Function\n\t");
-			std::cerr << std::endl;
-			std::exit(1);
+		AcquireGIL gil;
+		try {
+			if(py::override f = this->get_override("__call__"))
+				return Returner<R>::doReturn(f(ArgWrap<Args>::wrap(args)...));
+		} catch(const py::error_already_set &) {
+			// the error may be raised in a worker thread, so carry it as a C++ exception
+			throw PythonError();
 		}
+		print(std::cerr << "ERROR: override of '__call__' not found in Function\n\t");
+		std::cerr << std::endl;
+		std::exit(1);
 	}
 };
 
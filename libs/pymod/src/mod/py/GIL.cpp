@@ -0,0 +1,112 @@
+#include <mod/py/Common.hpp>
+
+#include "GIL.hpp"
+
+#include <cassert>
+#include <mutex>
+
+namespace mod {
+namespace Py {
+namespace {
+
+std::mutex callbackMutex;
+// the nesting depth of AcquireGIL scopes in this thread, which holds callbackMutex when it is positive
+thread_local int callbackDepth = 0;
+
+void lockCallbackMutex() {
+	if(PyGILState_Check()) {
+		// never wait for the exclusion while holding the GIL
+		PyThreadState *state = PyEval_SaveThread();
+		callbackMutex.lock();
+		PyEval_RestoreThread(state);
+	} else {
+		callbackMutex.lock();
+	}
+}
+
+void decRefWithGIL(PyObject *o) {
+	if(!o) return;
+	const PyGILState_STATE state = PyGILState_Ensure();
+	Py_DECREF(o);
+	PyGILState_Release(state);
+}
+
+std::shared_ptr<PyObject> takeReference(PyObject *o) {
+	return std::shared_ptr<PyObject>(o, &decRefWithGIL);
+}
+
+} // namespace
+
+ReleaseGIL::ReleaseGIL() : savedCallbackDepth(callbackDepth) {
+	if(savedCallbackDepth != 0) {
+		callbackDepth = 0;
+		callbackMutex.unlock();
+	}
+	state = PyEval_SaveThread();
+}
+
+ReleaseGIL::~ReleaseGIL() {
+	// take the exclusion back before the GIL, as in AcquireGIL
+	if(savedCallbackDepth != 0) {
+		callbackMutex.lock();
+		callbackDepth = savedCallbackDepth;
+	}
+	PyEval_RestoreThread(state);
+}
+
+AcquireGIL::AcquireGIL() {
+	if(callbackDepth == 0) lockCallbackMutex();
+	++callbackDepth;
+	state = PyGILState_Ensure();
+}
+
+AcquireGIL::~AcquireGIL() {
+	PyGILState_Release(state);
+	assert(callbackDepth > 0);
+	if(--callbackDepth == 0) callbackMutex.unlock();
+}
+
+PythonError::PythonError() {
+	PyObject *pType, *pValue, *pTraceback;
+	PyErr_Fetch(&pType, &pValue, &pTraceback);
+	assert(pType);
+	PyErr_NormalizeException(&pType, &pValue, &pTraceback);
+	type = takeReference(pType);
+	value = takeReference(pValue);
+	traceback = takeReference(pTraceback);
+	if(pValue) {
+		py::handle<> str(py::allow_null(PyObject_Str(pValue)));
+		if(str) msg = py::extract<std::string>(str.get());
+		else PyErr_Clear();
+	}
+}
+
+const char *PythonError::what() const noexcept {
+	return msg.c_str();
+}
+
+void PythonError::restore() const {
+	// PyErr_Restore steals the references
+	Py_XINCREF(type.get());
+	Py_XINCREF(value.get());
+	Py_XINCREF(traceback.get());
+	PyErr_Restore(type.get(), value.get(), traceback.get());
+}
+
+void GILDeleter::operator()(const void *) {
+	const PyGILState_STATE state = PyGILState_Ensure();
+	p.reset();
+	PyGILState_Release(state);
+}
+
+void GIL_doExport() {
+#if PY_VERSION_HEX < 0x03070000
+	PyEval_InitThreads();
+#endif
+	py::register_exception_translator<PythonError>([](const PythonError &e) {
+		e.restore();
+	});
+}
+
+} // namespace Py
+} // namespace mod
@@ -0,0 +1,82 @@
+#ifndef MOD_PY_GIL_H
+#define MOD_PY_GIL_H
+
+// Long-running calls into libmod release the GIL with a ReleaseGIL scope, so other Python threads can run.
+// While the GIL is released, the C++ code, in the calling thread or in worker threads,
+// may only call into Python through an AcquireGIL scope, e.g., as the wrappers of Python functions do.
+// The AcquireGIL scopes of all threads are mutually exclusive, also with a free-threaded Python build,
+// so the Python callbacks are run one at a time, while the C++ code of other threads keeps running.
+// A thread only waits for this exclusion while not holding the GIL, and a ReleaseGIL scope inside
+// an AcquireGIL scope, i.e., a long-running call from a callback, suspends the exclusion, so neither can deadlock.
+
+#include <boost/python.hpp>
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mod {
+namespace Py {
+
+struct ReleaseGIL {
+	ReleaseGIL();
+	ReleaseGIL(const ReleaseGIL &) = delete;
+	ReleaseGIL &operator=(const ReleaseGIL &) = delete;
+	~ReleaseGIL();
+private:
+	PyThreadState *state;
+	int savedCallbackDepth;
+};
+
+struct AcquireGIL {
+	AcquireGIL();
+	AcquireGIL(const AcquireGIL &) = delete;
+	AcquireGIL &operator=(const AcquireGIL &) = delete;
+	~AcquireGIL();
+private:
+	PyGILState_STATE state;
+};
+
+// A Python exception raised in a callback, carried through the C++ code, possibly to another thread,
+// and raised again when it reaches Python.
+struct PythonError : std::exception {
+	// pre: the GIL is held and a Python error is set, which is then cleared
+	PythonError();
+	const char *what() const noexcept override;
+	// Sets the carried exception as the current Python error.
+	// pre: the GIL is held
+	void restore() const;
+private:
+	std::shared_ptr<PyObject> type, value, traceback;
+	std::string msg;
+};
+
+// Deleter for shared pointers which may hold references to Python objects, such that they are released
+// with the GIL also when the last owner is C++ code in a ReleaseGIL scope.
+// Only the GIL is acquired, not the exclusion of AcquireGIL.
+struct GILDeleter {
+	void operator()(const void *);
+public:
+	std::shared_ptr<const void> p;
+};
+
+// pre: the GIL is held
+template<typename T>
+std::shared_ptr<T> withGILDeleter(std::shared_ptr<T> p) {
+	if(!p) return p;
+	T *raw = p.get();
+	return std::shared_ptr<T>(raw, GILDeleter{std::move(p)});
+}
+
+// pre: the GIL is held
+template<typename T>
+std::vector<std::shared_ptr<T> > withGILDeleter(std::vector<std::shared_ptr<T> > ps) {
+	for(auto &p : ps) p = withGILDeleter(std::move(p));
+	return ps;
+}
+
+} // namespace Py
+} // namespace mod
+
+#endif /* MOD_PY_GIL_H */
@@ -18,8 +18,8 @@
 	((graph, (Printer))) /* this must be before DGGraphInterface due to default arg */ \
 	((Chem)) ((Collections)) ((Config)) ((Derivation))                            \
 	((dg, (Builder) (DG) (GraphInterface) (Printer) (Strategy)))                  \
-	((Error)) ((Function))                                                        \
-	((graph, (Automorphism) (Graph) (GraphInterface)))                            \
+	((Error)) ((Function)) ((GIL))                                                \
+	((graph, (Automorphism) (Graph) (GraphInterface) (LazyGraph)))                \
 	((rule, (RC) (Rule) (GraphInterface)))                                        \
 	((Misc)) ((Term))
 
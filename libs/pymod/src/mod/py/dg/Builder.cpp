@@ -1,7 +1,12 @@
 #include <mod/py/Common.hpp>
+#include <mod/py/GIL.hpp>
 
 #include <mod/Derivation.hpp>
 #include <mod/dg/Builder.hpp>
+#include <mod/dg/ExecuteStatistics.hpp>
+#include <mod/rule/Rule.hpp>
+
+#include <boost/lexical_cast.hpp>
 
 namespace mod {
 namespace dg {
@@ -11,13 +16,58 @@ namespace {
 // see https://stackoverflow.com/questions/19062657/is-there-a-way-to-wrap-the-function-return-value-object-in-python-using-move-i
 
 std::shared_ptr<ExecuteResult>
-Builder_execute(std::shared_ptr<Builder> b, std::shared_ptr<Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes) {
-	return std::make_shared<ExecuteResult>(b->execute(strategy, verbosity, ignoreRuleLabelTypes));
+Builder_execute(std::shared_ptr<Builder> b, std::shared_ptr<Strategy> strategy, int verbosity, bool ignoreRuleLabelTypes,
+                RuleApplicationEngine engine) {
+	mod::Py::ReleaseGIL noGIL;
+	return std::make_shared<ExecuteResult>(b->execute(strategy, verbosity, ignoreRuleLabelTypes, engine));
+}
+
+void Builder_load(std::shared_ptr<Builder> b, const std::vector<std::shared_ptr<rule::Rule>> &ruleDatabase,
+                  const std::string &file, int verbosity) {
+	mod::Py::ReleaseGIL noGIL;
+	b->load(ruleDatabase, file, verbosity);
+}
+
+std::string RuleApplicationEngine_str(RuleApplicationEngine engine) {
+	return boost::lexical_cast<std::string>(engine);
+}
+
+std::shared_ptr<rule::Rule> RuleStatistics_getRule(const ExecuteStatistics::RuleStatistics &stats) {
+	return stats.rule;
+}
+
+py::list ExecuteStatistics_getRules(const ExecuteStatistics &stats) {
+	py::list res;
+	for(const auto &r : stats.rules) res.append(r);
+	return res;
+}
+
+py::list ExecuteStatistics_getStrategies(const ExecuteStatistics &stats) {
+	py::list res;
+	for(const auto &strat : stats.strategies) res.append(strat);
+	return res;
 }
 
 } // namespace
 
 void Builder_doExport() {
+	// rst: .. py:class:: DGRuleApplicationEngine
+	// rst:
+	// rst:		The method used by :py:meth:`DGBuilder.execute` for applying the rules of rule strategies.
+	// rst:		See :cpp:enum:`dg::RuleApplicationEngine` for details.
+	// rst:
+	py::enum_<RuleApplicationEngine>("DGRuleApplicationEngine")
+			// rst:		.. py:attribute:: Composition
+			// rst:
+			// rst:			Apply each rule by composing it with the bind rules of the graphs. This is the default.
+			.value("Composition", RuleApplicationEngine::Composition)
+					// rst:		.. py:attribute:: Direct
+					// rst:
+					// rst:			Apply each rule by matching the whole left side directly into the graphs,
+					// rst:			when the derivation graph uses :py:attr:`LabelType.String` without stereo information.
+			.value("Direct", RuleApplicationEngine::Direct);
+	py::def("_DGRuleApplicationEngine__str__", &RuleApplicationEngine_str);
+
 	using AddDerivation = DG::HyperEdge (Builder::*)(const Derivations &, IsomorphismPolicy);
 	// rst: .. py:class:: DGBuilder
 	// rst:
@@ -52,7 +102,8 @@ void Builder_doExport() {
 			// rst:				is different but isomorphic to another given graph object or to a graph object already
 			// rst:				in the internal graph database in the associated derivation graph.
 			.def("addDerivation", static_cast<AddDerivation>(&Builder::addDerivation))
-					// rst:		.. py:method:: execute(strategy, *, verbosity=2, ignoreRuleLabelTypes=False)
+					// rst:		.. py:method:: execute(strategy, *, verbosity=2, ignoreRuleLabelTypes=False, \
+					// rst:		                       engine=DGRuleApplicationEngine.Composition)
 					// rst:
 					// rst:			Execute the given strategy (:ref:`dgStrat`) and as a side-effect add
 					// rst:			vertices and hyperedges to the underlying derivation graph.
@@ -62,6 +113,7 @@ void Builder_doExport() {
 					// rst:				See :cpp:func:`dg::Builder::execute` for explanations of the levels.
 					// rst:			:param bool ignoreRuleLabelTypes: whether rules in the strategy should be checked beforehand for
 					// rst:				whether they have an associated :class:`LabelType` which matches the one in the underlying derivation graph.
+					// rst:			:param DGRuleApplicationEngine engine: the method used for applying rules.
 					// rst:			:returns: a proxy object for accessing the result of the exeuction.
 					// rst:			:rtype: DGExecuteResult
 					// rst:			:throws: :class:`LogicError` if a static "add" strategy has :attr:`IsomorphismPolicy.Check` as graph policy,
@@ -86,7 +138,19 @@ void Builder_doExport() {
 					// rst:
 					// rst:			:param str description: the description to parse into abstract derivations.
 					// rst:			:raises: :class:`InputError` if the description could not be parsed.
-			.def("addAbstract", &Builder::addAbstract);
+			.def("addAbstract", &Builder::addAbstract)
+					// rst:		.. py:method:: load(ruleDatabase, file, verbosity=2)
+					// rst:
+					// rst:			Load and add a derivation graph dump, e.g., to resume an interrupted or extended computation.
+					// rst:			See :cpp:func:`dg::Builder::load`.
+					// rst:
+					// rst:			:param ruleDatabase: the rules to link the rules of the dump to, by name.
+					// rst:			:type ruleDatabase: list[Rule]
+					// rst:			:param str file: a file from :py:meth:`DG.dump` or :py:meth:`DG.dumpBinary`.
+					// rst:			:param int verbosity: with a level of at least 2 the linking of graphs and rules is printed.
+					// rst:			:raises: :class:`InputError` if the file can not be opened or parsed,
+					// rst:				or if a rule of the dump is not in ``ruleDatabase``.
+			.def("load", &Builder_load);
 
 	// rst: .. py:class:: DGExecuteResult
 	// rst:
@@ -109,7 +173,129 @@ void Builder_doExport() {
 					// rst:			Output information from the execution of the strategy.
 					// rst:
 					// rst:			:param bool withUniverse: The universe lists can be rather long. As default they are omitted when listing.
-			.def("list", &ExecuteResult::list);
+			.def("list", &ExecuteResult::list)
+					// rst:		.. py:attribute:: statistics
+					// rst:
+					// rst:			(Read-only) The counters and timers collected during the execution.
+					// rst:
+					// rst:			:type: DGExecuteStatistics
+			.add_property("statistics", py::make_function(&ExecuteResult::getStatistics,
+			                                              py::return_internal_reference<1>()));
+
+	// rst: .. py:class:: DGExecuteStatistics
+	// rst:
+	// rst:		Counters and wall-clock timers collected during a call to :py:meth:`DGBuilder.execute`,
+	// rst:		e.g., for finding the rules which dominate a long computation.
+	// rst:		All times are in seconds.
+	// rst:
+	py::class_<ExecuteStatistics>("DGExecuteStatistics", py::no_init)
+			// rst:		.. py:attribute:: time
+			// rst:
+			// rst:			(Read-only) The time spent in the execution.
+			// rst:
+			// rst:			:type: float
+			.def_readonly("time", &ExecuteStatistics::time)
+					// rst:		.. py:attribute:: isomorphismCalls
+					// rst:
+					// rst:			(Read-only) The number of graph isomorphism checks performed during the execution,
+					// rst:			as counted by ``config.graph.numIsomorphismCalls``,
+					// rst:			but excluding the checks done concurrently by other threads, e.g., other executions.
+					// rst:
+					// rst:			:type: int
+			.def_readonly("isomorphismCalls", &ExecuteStatistics::isomorphismCalls)
+					// rst:		.. py:attribute:: productLookupTime
+					// rst:
+					// rst:			(Read-only) The time spent on looking up products in the graph database,
+					// rst:			which is mostly isomorphism checks.
+					// rst:
+					// rst:			:type: float
+			.def_readonly("productLookupTime", &ExecuteStatistics::productLookupTime)
+					// rst:		.. py:attribute:: rules
+					// rst:
+					// rst:			(Read-only) The statistics for each rule, in the order they were first executed.
+					// rst:
+					// rst:			:type: list[DGExecuteRuleStatistics]
+			.add_property("rules", &ExecuteStatistics_getRules)
+					// rst:		.. py:attribute:: strategies
+					// rst:
+					// rst:			(Read-only) The statistics for each kind of strategy, in the order they were first executed.
+					// rst:
+					// rst:			:type: list[DGExecuteStrategyStatistics]
+			.add_property("strategies", &ExecuteStatistics_getStrategies)
+					// rst:		.. py:method:: toJSON()
+					// rst:
+					// rst:			:returns: the statistics as a JSON object.
+					// rst:			:rtype: str
+			.def("toJSON", &ExecuteStatistics::toJSON);
+
+	// rst: .. py:class:: DGExecuteRuleStatistics
+	// rst:
+	// rst:		The statistics for all :ref:`strat-rule` strategies with the same rule.
+	// rst:		See :cpp:class:`dg::ExecuteStatistics::RuleStatistics` for the meaning of the attributes.
+	// rst:		All attributes are read-only.
+	// rst:
+	// rst:		.. py:attribute:: rule
+	// rst:
+	// rst:			:type: Rule
+	// rst:
+	// rst:		.. py:attribute:: executions
+	// rst:		                  bindingsTried
+	// rst:		                  compositions
+	// rst:		                  symmetricMatchesPruned
+	// rst:		                  derivations
+	// rst:		                  leftPredicateRejections
+	// rst:		                  rightPredicateRejections
+	// rst:		                  productsNew
+	// rst:		                  productsDuplicate
+	// rst:
+	// rst:			:type: int
+	// rst:
+	// rst:		.. py:attribute:: bindingTime
+	// rst:		                  time
+	// rst:
+	// rst:			:type: float
+	// rst:
+	using RuleStatistics = ExecuteStatistics::RuleStatistics;
+	py::class_<RuleStatistics>("DGExecuteRuleStatistics", py::no_init)
+			.add_property("rule", &RuleStatistics_getRule)
+			.def_readonly("executions", &RuleStatistics::executions)
+			.def_readonly("bindingsTried", &RuleStatistics::bindingsTried)
+			.def_readonly("compositions", &RuleStatistics::compositions)
+			.def_readonly("symmetricMatchesPruned", &RuleStatistics::symmetricMatchesPruned)
+			.def_readonly("derivations", &RuleStatistics::derivations)
+			.def_readonly("leftPredicateRejections", &RuleStatistics::leftPredicateRejections)
+			.def_readonly("rightPredicateRejections", &RuleStatistics::rightPredicateRejections)
+			.def_readonly("productsNew", &RuleStatistics::productsNew)
+			.def_readonly("productsDuplicate", &RuleStatistics::productsDuplicate)
+			.def_readonly("bindingTime", &RuleStatistics::bindingTime)
+			.def_readonly("time", &RuleStatistics::time);
+
+	// rst: .. py:class:: DGExecuteStrategyStatistics
+	// rst:
+	// rst:		The statistics for all strategies of the same kind.
+	// rst:		All attributes are read-only.
+	// rst:
+	// rst:		.. py:attribute:: kind
+	// rst:
+	// rst:			The kind of strategy, e.g., ``"Repeat"`` or ``"Rule"``.
+	// rst:
+	// rst:			:type: str
+	// rst:
+	// rst:		.. py:attribute:: executions
+	// rst:
+	// rst:			:type: int
+	// rst:
+	// rst:		.. py:attribute:: time
+	// rst:
+	// rst:			The time spent in the strategies, including the time spent in their substrategies.
+	// rst:
+	// rst:			:type: float
+	// rst:
+	using StrategyStatistics = ExecuteStatistics::StrategyStatistics;
+	py::class_<StrategyStatistics>("DGExecuteStrategyStatistics", py::no_init)
+			.def_readonly("kind", &StrategyStatistics::kind)
+			.def_readonly("executions", &StrategyStatistics::executions)
+			.def_readonly("time", &StrategyStatistics::time);
 }
 
 } // namespace Py
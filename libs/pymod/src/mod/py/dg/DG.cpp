@@ -1,4 +1,5 @@
 #include <mod/py/Common.hpp>
+#include <mod/py/GIL.hpp>
 
 #include <mod/Derivation.hpp>
 #include <mod/dg/Builder.hpp>
@@ -24,6 +25,20 @@ std::shared_ptr<Builder> DG_build(std::shared_ptr<DG> dg_) {
 	return std::make_shared<Builder>(dg_->build());
 }
 
+std::shared_ptr<DG> DG_make(LabelSettings labelSettings,
+                            const std::vector<std::shared_ptr<graph::Graph> > &graphDatabase,
+                            IsomorphismPolicy graphPolicy) {
+	mod::Py::ReleaseGIL noGIL;
+	return DG::make(labelSettings, graphDatabase, graphPolicy);
+}
+
+std::shared_ptr<DG> DG_dumpImport(const std::vector<std::shared_ptr<graph::Graph> > &graphs,
+                                  const std::vector<std::shared_ptr<rule::Rule> > &rules,
+                                  const std::string &file) {
+	mod::Py::ReleaseGIL noGIL;
+	return DG::dumpImport(graphs, rules, file);
+}
+
 } // namespace
 
 void DG_doExport() {
@@ -55,7 +70,7 @@ void DG_doExport() {
 			// rst:				absolutely sure that the graphs are unique up to isomorphism.
 			// rst:			:raises: :class:`LogicError` if ``graphPolicy == IsomorphismPolicy.Check`` and two graphs
 			// rst:				in ``graphDatabase`` are different objects but represents isomorphic graphs.
-			.def("__init__", py::make_constructor(&DG::make))
+			.def("__init__", py::make_constructor(&DG_make))
 					// rst:		.. py:attribute:: id
 					// rst:
 					// rst:			The unique instance id among all :class:`DG` objects.
@@ -180,6 +195,15 @@ void DG_doExport() {
 					// rst:			:rtype: str
 					// rst:			:raises: :py:class:`LogicError` if the DG has not been calculated.
 			.def("dump", &DG::dump)
+					// rst:		.. py:method:: dumpBinary()
+					// rst:
+					// rst:			Export the derivation graph to an external file in a binary format,
+					// rst:			see :cpp:func:`dg::DG::dumpBinary`. It can be loaded in the same ways as the text format.
+					// rst:
+					// rst:			:returns: the filename of the exported derivation graph.
+					// rst:			:rtype: str
+					// rst:			:raises: :py:class:`LogicError` if the DG has not been calculated.
+			.def("dumpBinary", &DG::dumpBinary)
 					// rst:		.. py:method:: listStats()
 					// rst:
 					// rst:			Lists various statistics for the derivation graph.
@@ -195,9 +219,10 @@ void DG_doExport() {
 	// rst:		:type graphs: list[Graph]
 	// rst:		:param rules: As for the graphs the same procedure is done for the rules, however only using the name of the rule for comparison.
 	// rst:		:type rules: list[Rule]
+	// rst:		:param str file: a file from :py:meth:`DG.dump` or :py:meth:`DG.dumpBinary`.
 	// rst:		:returns: the loaded derivation graph.
 	// rst:		:rtype: DG
-	py::def("dgDump", &DG::dumpImport);
+	py::def("dgDump", &DG_dumpImport);
 
 	// rst: .. py:method:: diffDGs(dg1, dg2)
 	// rst:
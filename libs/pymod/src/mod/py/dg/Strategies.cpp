@@ -28,14 +28,20 @@
 // rst:         : "execute(" executeFunc ")"
 // rst:         : "filterSubset(" filterPred ")"
 // rst:         : "filterUniverse(" filterPred ")"
+// rst:         : "filterSubsetBatch(" batchFilterPred ")"
+// rst:         : "filterUniverseBatch(" batchFilterPred ")"
 // rst:         : "leftPredicate[" derivationPred "](" `strat` ")"
 // rst:         : "rightPredicate[" derivationPred "](" `strat` ")"
 // rst:         : "repeat" [ "[" int "]" ] "(" strat ")"
 // rst:         : "revive(" `strat` ")"
+// rst:         : "sortSubsetByKey(" keyFunc ")"
+// rst:         : "sortUniverseByKey(" keyFunc ")"
 // rst:
 // rst: A ``strats`` must be an iterable of :token:`~dgStrat:strat`, e.g., an iterable of :class:`Rule`.
 // rst: A ``graphs`` can either be a single :class:`Graph`, an iterable of graphs,
 // rst: or a function taking no arguments and returning a list of graphs.
+// rst: It can also be an iterable of :class:`LazyGraph`, in which case the keyword argument ``rules``
+// rst: can be given to only load the graphs which may match one of the rules, see :py:meth:`DGStrat.makeAddLazy`.
 // rst:
 
 namespace mod {
@@ -72,6 +78,9 @@ void Strategy_doExport() {
 	const std::vector<std::shared_ptr<graph::Graph>> &, IsomorphismPolicy) = &Strategy::makeAdd;
 	std::shared_ptr<Strategy>(*makeAdd_dynamic)(bool,
 	const std::shared_ptr<mod::Function<std::vector<std::shared_ptr<graph::Graph>>()>>, IsomorphismPolicy) = &Strategy::makeAdd;
+	std::shared_ptr<Strategy>(*makeAdd_lazy)(bool,
+	const std::vector<std::shared_ptr<graph::LazyGraph>> &, const std::vector<std::shared_ptr<rule::Rule>> &,
+	IsomorphismPolicy) = &Strategy::makeAdd;
 
 	// rst: .. py:class:: DGStrat
 	// rst: 
@@ -95,6 +104,18 @@ void Strategy_doExport() {
 					// rst:			:returns: an :ref:`strat-addUniverse` strategy if ``onlyUniverse`` is ``True``, otherwise an :ref:`strat-addSubset` strategy.
 					// rst:			:rtype: DGStrat
 			.def("makeAddDynamic", makeAdd_dynamic).staticmethod("makeAddDynamic")
+					// rst:		.. py:staticmethod:: makeAddLazy(onlyUniverse, graphs, rules, graphPolicy)
+					// rst:
+					// rst:			:param bool onlyUniverse: if the strategy is :ref:`strat-addUniverse` or :ref:`strat-addSubset`.
+					// rst:			:param graphs: the lazy graphs to be added by the strategy.
+					// rst:			:type graphs: list[LazyGraph]
+					// rst:			:param rules: only the graphs which may match at least one of these rules are loaded and added,
+					// rst:				see :py:meth:`LazyGraph.mayMatch`. If empty, all graphs are loaded and added.
+					// rst:			:type rules: list[Rule]
+					// rst:			:param IsomorphismPolicy graphPolicy: refers to the checking of each added graph against the internal graph database.
+					// rst:			:returns: an :ref:`strat-addUniverse` strategy if ``onlyUniverse`` is ``True``, otherwise an :ref:`strat-addSubset` strategy.
+					// rst:			:rtype: DGStrat
+			.def("makeAddLazy", makeAdd_lazy).staticmethod("makeAddLazy")
 					// rst:		.. py:staticmethod:: makeExecute(func)
 					// rst:
 					// rst:			:param func: A function being executed when the strategy is evaluated.
@@ -112,6 +133,18 @@ void Strategy_doExport() {
 					// rst:			:returns: a :ref:`strat-filterUniverse` strategy if ``onlyUniverse`` is ``True``, otherwise a :ref:`strat-filterSubset` strategy.
 					// rst:			:rtype: DGStrat
 			.def("makeFilter", &Strategy::makeFilter).staticmethod("makeFilter")
+					// rst:		.. py:staticmethod:: makeFilterBatch(alsoUniverse, p)
+					// rst:
+					// rst:			:param bool alsoUniverse: if the strategy is :ref:`strat-filterUniverse` or :ref:`strat-filterSubset`.
+					// rst:			:param p: the filtering predicate being called once with all the graphs in either the subset or the universe,
+					// rst:				and the graph state. It must return an iterable of truth values, e.g., a list or a NumPy array,
+					// rst:				stating for each of the graphs whether to keep it.
+					// rst:				This avoids the overhead of calling a Python function for each graph.
+					// rst:			:type p: Callable[[list[Graph], DGStratGraphState], list[bool]]
+					// rst:			:returns: a :ref:`strat-filterUniverse` strategy if ``alsoUniverse`` is ``True``, otherwise a :ref:`strat-filterSubset` strategy.
+					// rst:			:rtype: DGStrat
+					// rst:			:raises: :class:`LogicError` during evaluation if `p` does not return exactly one value for each graph.
+			.def("makeFilterBatch", &Strategy::makeFilterBatch).staticmethod("makeFilterBatch")
 					// rst:		.. py:staticmethod:: makeLeftPredicate(p, strat)
 					// rst:
 					// rst:			:param p: the predicate to be called on each candidate derivation.
@@ -165,6 +198,15 @@ void Strategy_doExport() {
 					// rst:			:raises: :class:`LogicError` if the given list of strategies is empty.
 			.def("makeSequence", &Strategy::makeSequence).staticmethod("makeSequence")
 			.def("makeSort", &Strategy::makeSort).staticmethod("makeSort") // TODO: remove
+					// rst:		.. py:staticmethod:: makeSortByKey(doUniverse, key)
+					// rst:
+					// rst:			:param bool doUniverse: if the universe or the subset should be sorted.
+					// rst:			:param key: the key function being called once for each graph in either the subset or the universe.
+					// rst:				The graphs are then stably sorted in increasing order of their keys, with graphs with a NaN key last.
+					// rst:			:type key: Callable[[Graph], float]
+					// rst:			:returns: a :ref:`strat-sort` strategy.
+					// rst:			:rtype: DGStrat
+			.def("makeSortByKey", &Strategy::makeSortByKey).staticmethod("makeSortByKey")
 			.def("makeTake", &Strategy::makeTake).staticmethod("makeTake") // TODO: remove
 			;
 }
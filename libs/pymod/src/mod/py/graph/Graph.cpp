@@ -1,4 +1,5 @@
 #include <mod/py/Common.hpp>
+#include <mod/py/GIL.hpp>
 
 #include <mod/graph/Graph.hpp>
 #include <mod/graph/Automorphism.hpp>
@@ -10,6 +11,31 @@
 namespace mod {
 namespace graph {
 namespace Py {
+namespace {
+
+std::size_t Graph_isomorphism(std::shared_ptr<Graph> g, std::shared_ptr<Graph> other, std::size_t maxNumMatches,
+                              LabelSettings labelSettings) {
+	mod::Py::ReleaseGIL noGIL;
+	return g->isomorphism(other, maxNumMatches, labelSettings);
+}
+
+std::size_t Graph_monomorphism(std::shared_ptr<Graph> g, std::shared_ptr<Graph> other, std::size_t maxNumMatches,
+                               LabelSettings labelSettings) {
+	mod::Py::ReleaseGIL noGIL;
+	return g->monomorphism(other, maxNumMatches, labelSettings);
+}
+
+void Graph_precompute(const std::vector<std::shared_ptr<Graph> > &graphs, LabelSettings labelSettings) {
+	mod::Py::ReleaseGIL noGIL;
+	Graph::precompute(graphs, labelSettings);
+}
+
+void Graph_canonicalise(const std::vector<std::shared_ptr<Graph> > &graphs) {
+	mod::Py::ReleaseGIL noGIL;
+	Graph::canonicalise(graphs);
+}
+
+} // namespace
 
 void Graph_doExport() {
 	std::pair<std::string, std::string>(Graph::*
@@ -195,7 +221,7 @@ void Graph_doExport() {
 					// rst:			:param LabelSettings labelSettings: the label settings to use during the search.
 					// rst:			:returns: the number of isomorphisms from this graph to ``other``, but at most ``maxNumMatches``.
 					// rst:			:rtype: int
-			.def("isomorphism", &Graph::isomorphism)
+			.def("isomorphism", &Graph_isomorphism)
 					// rst:		.. py:method:: monomorphism(other, maxNumMatches=1, labelSettings=LabelSettings(LabelType.String, LabelRelation.Isomorphism))
 					// rst:
 					// rst:			:param Graph other: the codomain :class:`Graph` for finding morphisms.
@@ -203,7 +229,7 @@ void Graph_doExport() {
 					// rst:			:param LabelSettings labelSettings: the label settings to use during the search.
 					// rst:			:returns: the number of monomorphisms from this graph to ``other``, though at most ``maxNumMatches``.
 					// rst:			:rtype: int
-			.def("monomorphism", &Graph::monomorphism)
+			.def("monomorphism", &Graph_monomorphism)
 					// rst:		.. py:method:: makePermutation()
 					// rst:
 					// rst:			:returns: a graph isomorphic to this, but with the vertex indices randomly permuted.
@@ -307,6 +333,24 @@ void Graph_doExport() {
 	// rst:		:rtype: Graph
 	// rst:		:raises: :class:`InputError` on bad input.
 	py::def("smiles", &Graph::smiles);
+	// rst: .. py:method:: precomputeGraphs(graphs, labelSettings=LabelSettings(LabelType.String, LabelRelation.Isomorphism))
+	// rst:
+	// rst:		Compute in parallel the data of the graphs which is otherwise computed on first use
+	// rst:		during rule application and isomorphism checks, see :cpp:func:`graph::Graph::precompute`.
+	// rst:
+	// rst:		:param graphs: the graphs to process.
+	// rst:		:type graphs: list[Graph]
+	// rst:		:param LabelSettings labelSettings: the label settings the graphs will be used with.
+	// rst:		:raises: :class:`StereoDeductionError` if stereo data is needed but its deduction failed for a graph.
+	py::def("precomputeGraphs", &Graph_precompute);
+	// rst: .. py:method:: canonicaliseGraphs(graphs)
+	// rst:
+	// rst:		Compute in parallel the canonical forms, the canonical SMILES strings, and the GraphDFS strings of the graphs,
+	// rst:		which afterwards are cached, see :cpp:func:`graph::Graph::canonicalise`.
+	// rst:
+	// rst:		:param graphs: the graphs to process.
+	// rst:		:type graphs: list[Graph]
+	py::def("canonicaliseGraphs", &Graph_canonicalise);
 }
 
 } // namespace Py
@@ -0,0 +1,100 @@
+#include <mod/py/Common.hpp>
+
+#include <mod/graph/Graph.hpp>
+#include <mod/graph/LazyGraph.hpp>
+#include <mod/rule/Rule.hpp>
+
+namespace mod {
+namespace graph {
+namespace Py {
+
+void LazyGraph_doExport() {
+	bool (LazyGraph::*mayMatch)(std::shared_ptr<rule::Rule>, LabelType) const = &LazyGraph::mayMatch;
+
+	// rst: .. py:class:: LazyGraph
+	// rst:
+	// rst:		A handle for a graph which is only loaded when needed.
+	// rst:		The handle stores the source data of the graph and a small summary of it:
+	// rst:		the number of vertices and edges, and the number of occurrences of each vertex and edge label.
+	// rst:		The full :class:`Graph` is loaded on the first access through :py:meth:`getGraph`,
+	// rst:		and the handle keeps it alive until :py:meth:`release` is called.
+	// rst:		As long as the graph is alive, e.g., because it has been added to a derivation graph,
+	// rst:		:py:meth:`getGraph` returns the same object.
+	// rst:		Lazy graphs can be added to a derivation graph with :py:func:`addSubset` and :py:func:`addUniverse`.
+	// rst:
+	py::class_<LazyGraph, std::shared_ptr<LazyGraph>, boost::noncopyable>("LazyGraph", py::no_init)
+			// rst:		.. py:method:: getGraph()
+			// rst:
+			// rst:			:returns: the full graph, loaded from the source data if needed.
+			// rst:			:rtype: Graph
+			// rst:			:raises: :class:`InputError` if the source data can no longer be loaded.
+			.def("getGraph", &LazyGraph::getGraph)
+					// rst:		.. py:attribute:: isMaterialised
+					// rst:
+					// rst:			(Read-only) Whether the full graph is currently loaded.
+					// rst:
+					// rst:			:type: bool
+			.add_property("isMaterialised", &LazyGraph::isMaterialised)
+					// rst:		.. py:method:: release()
+					// rst:
+					// rst:			Drop the reference to the full graph held by this handle.
+					// rst:			The graph is only destroyed if no one else has a reference to it.
+			.def("release", &LazyGraph::release)
+					// rst:		.. py:attribute:: name
+					// rst:
+					// rst:			The name of the graph. If it is not set, the name from the source data is used,
+					// rst:			which is only known after the graph has been loaded.
+					// rst:
+					// rst:			:type: str
+			.add_property("name", &LazyGraph::getName, &LazyGraph::setName)
+					// rst:		.. py:attribute:: numVertices
+					// rst:		                  numEdges
+					// rst:
+					// rst:			(Read-only) The number of vertices or edges in the graph, available without loading it.
+					// rst:
+					// rst:			:type: int
+			.add_property("numVertices", &LazyGraph::numVertices)
+			.add_property("numEdges", &LazyGraph::numEdges)
+					// rst:		.. py:method:: vLabelCount(label)
+					// rst:		               eLabelCount(label)
+					// rst:
+					// rst:			:param str label: the label to count.
+					// rst:			:returns: the number of vertices or edges with the given label, without loading the graph.
+					// rst:			:rtype: int
+			.def("vLabelCount", &LazyGraph::vLabelCount)
+			.def("eLabelCount", &LazyGraph::eLabelCount)
+					// rst:		.. py:method:: mayMatch(r, labelType)
+					// rst:
+					// rst:			A quick test, without loading the graph, of whether some connected component of the left side
+					// rst:			of the given rule may have a monomorphism into the graph.
+					// rst:			For :py:const:`LabelType.Term` the result is always ``True``.
+					// rst:
+					// rst:			:param Rule r: the rule to test.
+					// rst:			:param LabelType labelType: the label type to test with.
+					// rst:			:returns: ``False`` only if no match can exist.
+					// rst:			:rtype: bool
+			.def("mayMatch", mayMatch);
+
+	// rst: .. py:method:: lazyGraphGMLString(s, name=None)
+	// rst:                lazyGraphGML(f, name=None)
+	// rst:                lazyGraphDFS(s, name=None)
+	// rst:                lazySmiles(s, name=None)
+	// rst:
+	// rst:		Create a :class:`LazyGraph` for a graph in the given format,
+	// rst:		see :py:func:`graphGMLString`, :py:func:`graphGML`, :py:func:`graphDFS`, and :py:func:`smiles`.
+	// rst:		The data is loaded once to validate it and to compute the summary.
+	// rst:		The handles are not appended to :data:`inputGraphs`.
+	// rst:
+	// rst:		:param str name: the name of the graph. If none is given the name from the source data is used.
+	// rst:		:returns: the handle.
+	// rst:		:rtype: LazyGraph
+	// rst:		:raises: :class:`InputError` on bad input.
+	py::def("lazyGraphGMLString", &LazyGraph::graphGMLString);
+	py::def("lazyGraphGML", &LazyGraph::graphGML);
+	py::def("lazyGraphDFS", &LazyGraph::graphDFS);
+	py::def("lazySmiles", &LazyGraph::smiles);
+}
+
+} // namespace Py
+} // namespace graph
+} // namespace mod
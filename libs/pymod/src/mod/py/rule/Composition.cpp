@@ -1,4 +1,5 @@
 #include <mod/py/Common.hpp>
+#include <mod/py/GIL.hpp>
 
 #include <mod/rule/Composer.hpp>
 #include <mod/rule/CompositionExpr.hpp>
@@ -53,6 +54,7 @@ std::vector<std::shared_ptr<Rule> > getProducts(std::shared_ptr<Composer> rc) {
 }
 
 std::vector<std::shared_ptr<Rule> > eval(std::shared_ptr<Composer> rc, const RCExp::Expression &e, int verbosity) {
+	mod::Py::ReleaseGIL noGIL;
 	auto result = rc->eval(e, verbosity);
 	return std::vector<std::shared_ptr<Rule> >(begin(result), end(result));
 }
@@ -1,4 +1,5 @@
 #include <mod/py/Common.hpp>
+#include <mod/py/GIL.hpp>
 
 #include <mod/graph/Printer.hpp>
 #include <mod/rule/GraphInterface.hpp>
@@ -14,6 +15,18 @@ py::object getLabelType(std::shared_ptr<Rule> r) {
 	else return py::object();
 }
 
+std::size_t Rule_isomorphism(std::shared_ptr<Rule> r, std::shared_ptr<Rule> other, std::size_t maxNumMatches,
+                             LabelSettings labelSettings) {
+	mod::Py::ReleaseGIL noGIL;
+	return r->isomorphism(other, maxNumMatches, labelSettings);
+}
+
+std::size_t Rule_monomorphism(std::shared_ptr<Rule> r, std::shared_ptr<Rule> other, std::size_t maxNumMatches,
+                              LabelSettings labelSettings) {
+	mod::Py::ReleaseGIL noGIL;
+	return r->monomorphism(other, maxNumMatches, labelSettings);
+}
+
 } // namespace
 
 void Rule_doExport() {
@@ -154,7 +167,9 @@ void Rule_doExport() {
 					// rst:			:param LabelSettings labelSettings: the label settings to use during the search.
 					// rst:			:returns: the number of isomorphisms found between ``other`` and this rule, but at most ``maxNumMatches``.
 					// rst:			:rtype: int
-			.def("isomorphism", &Rule::isomorphism)
+					// rst:
+					// rst:			See :cpp:func:`rule::Rule::isomorphism` for when canonical forms are used.
+			.def("isomorphism", &Rule_isomorphism)
 					// rst:		.. py:method:: monomorphism(host, maxNumMatches=1, labelSettings=LabelSettings(LabelType.String, LabelRelation.Isomorphism))
 					// rst:
 					// rst:			:param Rule host: the host :class:`Rule` to check for subgraphs.
@@ -162,7 +177,7 @@ void Rule_doExport() {
 					// rst:			:param LabelSettings labelSettings: the label settings to use during the search.
 					// rst:			:returns: the number of monomorphisms from this rule to subgraphs of ``host``, though at most ``maxNumMatches``.
 					// rst:			:rtype: int
-			.def("monomorphism", &Rule::monomorphism)
+			.def("monomorphism", &Rule_monomorphism)
 					// rst:		.. py:method:: isomorphicLeftRight(other, labelSettings=LabelSettings(LabelType.String, LabelRelation.Isomorphism))
 					// rst:
 					// rst:			:param Rule other: the other :class:`Rule` for comparison.
@@ -0,0 +1,138 @@
+#include <jla_boost/graph/EdgeIndexedAdjacencyList.hpp>
+#include <jla_boost/graph/EdgeIndexedCSRGraph.hpp>
+#include <jla_boost/graph/PairToRangeAdaptor.hpp>
+
+#undef NDEBUG
+
+#include <cassert>
+#include <cstddef>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// EdgeIndexedCSRGraph must behave as EdgeIndexedAdjacencyList with the same additions,
+// both before and after freezing, and when adding to a frozen graph.
+// Neither graph supports removal of vertices or edges.
+
+using namespace jla_boost;
+
+using Ref = EdgeIndexedAdjacencyList<boost::undirectedS>;
+using CSR = EdgeIndexedCSRGraph<boost::undirectedS>;
+
+template<typename G, typename E>
+std::tuple<std::size_t, std::size_t, std::size_t> edgeTuple(const G &g, E e) {
+	return std::make_tuple(get(boost::vertex_index_t(), g, source(e, g)),
+	                       get(boost::vertex_index_t(), g, target(e, g)),
+	                       get(boost::edge_index_t(), g, e));
+}
+
+void check(const Ref &gRef, const CSR &g) {
+	const std::size_t n = num_vertices(gRef);
+	assert(num_vertices(g) == n);
+	assert(num_edges(g) == num_edges(gRef));
+	{
+		std::vector<std::tuple<std::size_t, std::size_t, std::size_t> > esRef, es;
+		for(const auto e : asRange(edges(gRef))) esRef.push_back(edgeTuple(gRef, e));
+		for(const auto e : asRange(edges(g))) es.push_back(edgeTuple(g, e));
+		assert(es == esRef);
+		// the edge indices are the insertion order
+		for(std::size_t i = 0; i != es.size(); ++i)
+			assert(std::get<2>(es[i]) == i);
+	}
+	for(const auto v : asRange(vertices(g))) {
+		const auto vRef = vertex(v, gRef);
+		assert(get(boost::vertex_index_t(), g, v) == v);
+		assert(out_degree(v, g) == out_degree(vRef, gRef));
+		assert(in_degree(v, g) == in_degree(vRef, gRef));
+		assert(degree(v, g) == degree(vRef, gRef));
+		std::vector<std::tuple<std::size_t, std::size_t, std::size_t> > outRef, out, inRef, in;
+		for(const auto e : asRange(out_edges(vRef, gRef))) outRef.push_back(edgeTuple(gRef, e));
+		for(const auto e : asRange(out_edges(v, g))) out.push_back(edgeTuple(g, e));
+		assert(out == outRef);
+		for(const auto e : asRange(in_edges(vRef, gRef))) inRef.push_back(edgeTuple(gRef, e));
+		for(const auto e : asRange(in_edges(v, g))) in.push_back(edgeTuple(g, e));
+		assert(in == inRef);
+		for(const auto &t : out) assert(std::get<0>(t) == v);
+		for(const auto &t : in) assert(std::get<1>(t) == v);
+		std::vector<std::size_t> adjRef, adj;
+		for(const auto u : asRange(adjacent_vertices(vRef, gRef))) adjRef.push_back(u);
+		for(const auto u : asRange(adjacent_vertices(v, g))) adj.push_back(u);
+		assert(adj == adjRef);
+	}
+	for(std::size_t u = 0; u != n; ++u) {
+		for(std::size_t v = 0; v != n; ++v) {
+			const auto eRef = edge(vertex(u, gRef), vertex(v, gRef), gRef);
+			const auto e = edge(vertex(u, g), vertex(v, g), g);
+			assert(e.second == eRef.second);
+			if(!e.second) continue;
+			assert(source(e.first, g) == u);
+			assert(target(e.first, g) == v);
+			assert(get(boost::edge_index_t(), g, e.first) == get(boost::edge_index_t(), gRef, eRef.first));
+		}
+	}
+}
+
+void addRandom(Ref &gRef, CSR &g, std::mt19937 &rng, std::size_t numVertices, std::size_t numEdges) {
+	for(std::size_t i = 0; i != numVertices; ++i) {
+		const auto vRef = add_vertex(gRef);
+		const auto v = add_vertex(g);
+		assert(v == vRef);
+	}
+	const std::size_t n = num_vertices(g);
+	if(n < 2) return;
+	std::uniform_int_distribution<std::size_t> dist(0, n - 1);
+	for(std::size_t i = 0; i != numEdges; ++i) {
+		const std::size_t u = dist(rng);
+		std::size_t v = dist(rng);
+		// no loops, but parallel edges are allowed
+		if(u == v) v = (v + 1) % n;
+		const auto eRef = add_edge(vertex(u, gRef), vertex(v, gRef), gRef);
+		const auto e = add_edge(u, v, g);
+		assert(e.second && eRef.second);
+		assert(edgeTuple(g, e.first) == edgeTuple(gRef, eRef.first));
+	}
+}
+
+int main() {
+	std::mt19937 rng(42);
+	{ // empty
+		Ref gRef;
+		CSR g;
+		check(gRef, g);
+		g.freeze();
+		assert(g.isFrozen());
+		check(gRef, g);
+	}
+	for(int round = 0; round != 20; ++round) {
+		Ref gRef;
+		CSR g;
+		// unfrozen
+		addRandom(gRef, g, rng, 2 + round, 2 * round);
+		assert(!g.isFrozen());
+		check(gRef, g);
+		g.freeze();
+		assert(g.isFrozen());
+		check(gRef, g);
+		// freezing again changes nothing
+		g.freeze();
+		check(gRef, g);
+		// adding edges and vertices thaws the graph, and freezing again keeps the indices
+		addRandom(gRef, g, rng, 0, 3);
+		assert(!g.isFrozen());
+		check(gRef, g);
+		g.freeze();
+		check(gRef, g);
+		addRandom(gRef, g, rng, 2, 5);
+		assert(!g.isFrozen());
+		check(gRef, g);
+		g.freeze();
+		check(gRef, g);
+		// a vertex without edges after freezing
+		add_vertex(gRef);
+		add_vertex(g);
+		assert(!g.isFrozen());
+		check(gRef, g);
+		g.freeze();
+		check(gRef, g);
+	}
+}
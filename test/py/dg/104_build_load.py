@@ -0,0 +1,41 @@
+include("xx0_helpers.py")
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+strat = addSubset(graphs) >> repeat[2](rules)
+
+def stats(dg):
+	return (dg.numVertices, dg.numEdges)
+
+dgRef = DG(graphDatabase=graphs)
+dgRef.build().execute(strat)
+fText = dgRef.dump()
+fBinary = dgRef.dumpBinary()
+
+# both formats can be imported
+for f in [fText, fBinary]:
+	dg = dgDump(graphs, rules, CWDPath(f))
+	assert stats(dg) == stats(dgRef)
+	for g in graphs:
+		assert not dg.findVertex(g).isNull()
+
+# and loaded into a builder, e.g., to continue the expansion
+for f in [fText, fBinary]:
+	dg = DG(graphDatabase=graphs)
+	with dg.build() as b:
+		b.load(rules, CWDPath(f))
+		assert stats(dg) == stats(dgRef)
+		# loading again changes nothing
+		b.load(rules, CWDPath(f), verbosity=0)
+		assert stats(dg) == stats(dgRef)
+	assert stats(dg) == stats(dgRef)
+
+dg = DG(graphDatabase=graphs)
+with dg.build() as b:
+	try:
+		b.load([], CWDPath(fBinary))
+		assert False
+	except InputError as e:
+		assert "Rule not found" in str(e)
+	fail(lambda: b.load(rules, CWDPath("doesNotExist.dgb")), "DG dump file not found, 'doesNotExist.dgb'\n", err=InputError)
@@ -0,0 +1,62 @@
+include("xx0_helpers.py")
+
+# a rule which needs an oxygen with a hydrogen
+r = ruleGMLString("""rule [
+	ruleID "OH"
+	left [ edge [ source 1 target 2 label "-" ] ]
+	context [
+		node [ id 1 label "O" ]
+		node [ id 2 label "H" ]
+	]
+	right [ edge [ source 1 target 2 label "=" ] ]
+]""")
+
+water = lazySmiles("O", name="Water")
+methane = lazySmiles("C", name="Methane")
+assert not water.isMaterialised
+assert water.numVertices == 3 and water.numEdges == 2
+assert water.vLabelCount("O") == 1 and water.vLabelCount("H") == 2
+assert water.eLabelCount("-") == 2
+assert methane.vLabelCount("O") == 0
+assert water.mayMatch(r, LabelType.String)
+assert not methane.mayMatch(r, LabelType.String)
+assert methane.mayMatch(r, LabelType.Term)
+
+# the graph is shared while alive
+g = water.getGraph()
+assert water.isMaterialised
+assert g.name == "Water"
+water.release()
+assert water.isMaterialised
+assert water.getGraph().id == g.id
+water.release()
+del g
+assert not water.isMaterialised
+
+# only the graphs matching the rules are loaded
+dg = DG()
+dg.build().execute(addSubset(water, methane, rules=[r]))
+assert dg.numVertices == 1
+assert not dg.findVertex(water.getGraph()).isNull()
+water.release()
+assert not methane.isMaterialised
+
+# without rules everything is loaded
+dg = DG()
+dg.build().execute(addSubset([water, methane]))
+assert dg.numVertices == 2
+assert water.isMaterialised and methane.isMaterialised
+
+fail(lambda: addSubset(water, smiles("C", add=False)), "Can not mix Graph and LazyGraph in addSubset/addUniverse.", err=TypeError)
+fail(lambda: addSubset([smiles("C", add=False)], rules=[r]), "Only addSubset/addUniverse with lazy graphs take rules.", err=TypeError)
+try:
+	lazySmiles("[")
+	assert False
+except InputError:
+	pass
+
+# creating a handle only parses the data, so no graph is created
+g1 = smiles("O", add=False)
+lazySmiles("CCO")
+g2 = smiles("O", add=False)
+assert g2.id == g1.id + 1
@@ -0,0 +1,31 @@
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+strats = [
+	addSubset(graphs) >> repeat[3](rules),
+	addSubset(graphs) >> repeat[3]([[ketoEnol_F, ketoEnol_B], [aldolAdd_F, aldolAdd_B]]),
+]
+
+labelSettings = [
+	LabelSettings(LabelType.String, LabelRelation.Isomorphism),
+	LabelSettings(LabelType.Term, LabelRelation.Specialisation),
+]
+
+def summary(strat, ls):
+	dg = DG(graphDatabase=graphs, labelSettings=ls)
+	res = dg.build().execute(strat)
+	vs = [v.graph.name for v in dg.vertices]
+	es = [([v.graph.name for v in e.sources], [v.graph.name for v in e.targets], [r.name for r in e.rules])
+		for e in dg.edges]
+	return vs, es, [g.name for g in res.subset], [g.name for g in res.universe]
+
+for strat in strats:
+	for ls in labelSettings:
+		config.common.numThreads = 1
+		ref = summary(strat, ls)
+		config.common.numThreads = 4
+		res = summary(strat, ls)
+		config.common.numThreads = 1
+		assert len(ref[0]) > len(graphs)
+		assert res == ref
@@ -0,0 +1,22 @@
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+strat = addSubset(graphs) >> repeat[4](rules)
+
+def summary():
+	dg = DG(graphDatabase=graphs)
+	dg.build().execute(strat)
+	vs = sorted(v.graph.smiles for v in dg.vertices)
+	es = sorted((sorted(v.graph.smiles for v in e.sources), sorted(v.graph.smiles for v in e.targets),
+		sorted(r.name for r in e.rules)) for e in dg.edges)
+	return vs, es
+
+config.dg.ignoreSubset = True
+ref = summary()
+config.dg.semiNaiveRepeat = True
+res = summary()
+config.dg.semiNaiveRepeat = False
+config.dg.ignoreSubset = False
+assert len(ref[0]) > len(graphs)
+assert res == ref
@@ -0,0 +1,22 @@
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+strat = addSubset(graphs) >> repeat[3](rules)
+
+def summary():
+	dg = DG(graphDatabase=graphs)
+	with dg.build() as b:
+		b.execute(strat)
+		b.execute(strat >> rules)
+	vs = sorted(v.graph.smiles for v in dg.vertices)
+	es = sorted((sorted(v.graph.smiles for v in e.sources), sorted(v.graph.smiles for v in e.targets),
+		sorted(r.name for r in e.rules)) for e in dg.edges)
+	return vs, es
+
+ref = summary()
+config.dg.useCompositionCache = True
+res = summary()
+config.dg.useCompositionCache = False
+assert len(ref[0]) > len(graphs)
+assert res == ref
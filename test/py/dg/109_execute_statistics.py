@@ -0,0 +1,29 @@
+import json
+
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+
+dg = DG(graphDatabase=graphs)
+with dg.build() as b:
+	res = b.execute(addSubset(graphs) >> repeat[2](rules))
+stats = res.statistics
+assert stats.time >= 0
+assert [s.rule.name for s in stats.rules] == [r.name for r in rules]
+for s in stats.rules:
+	assert s.executions == 2
+	assert s.bindingsTried > 0
+	assert s.compositions >= s.derivations
+	assert s.leftPredicateRejections == 0
+	assert s.rightPredicateRejections == 0
+assert sum(s.productsNew for s in stats.rules) == dg.numVertices - len(graphs)
+kinds = {s.kind: s for s in stats.strategies}
+assert kinds["Repeat"].executions == 1
+assert kinds["Rule"].executions == 8
+assert kinds["Add"].executions == 1
+
+data = json.loads(stats.toJSON())
+assert data["isomorphismCalls"] == stats.isomorphismCalls
+assert [r["rule"] for r in data["rules"]] == [r.name for r in rules]
+assert [s["kind"] for s in data["strategies"]] == [s.kind for s in stats.strategies]
@@ -0,0 +1,47 @@
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+# deletes a vertex without its edges, i.e., is only applicable to isolated vertices
+removeO = ruleGMLString("""rule [
+	ruleID "remove O"
+	left [ node [ id 0 label "O" ] ]
+]""")
+# creates an edge, i.e., is not applicable when the vertices already are adjacent
+closeRing = ruleGMLString("""rule [
+	ruleID "close ring"
+	context [
+		node [ id 0 label "C" ]
+		node [ id 1 label "O" ]
+	]
+	right [ edge [ source 0 target 1 label "-" ] ]
+]""")
+
+def summary(strat, engine, ls):
+	dg = DG(graphDatabase=graphs, labelSettings=ls)
+	with dg.build() as b:
+		b.execute(strat, engine=engine)
+	vs = sorted(v.graph.smiles for v in dg.vertices)
+	es = sorted((sorted(v.graph.smiles for v in e.sources), sorted(v.graph.smiles for v in e.targets),
+		sorted(r.name for r in e.rules)) for e in dg.edges)
+	return vs, es
+
+def check(strat, ls=LabelSettings(LabelType.String, LabelRelation.Isomorphism)):
+	ref = summary(strat, DGRuleApplicationEngine.Composition, ls)
+	res = summary(strat, DGRuleApplicationEngine.Direct, ls)
+	assert res == ref, "{}\n{}".format(ref, res)
+	return ref
+
+assert str(DGRuleApplicationEngine.Direct) == "direct"
+
+vs, es = check(addSubset(graphs) >> repeat[3](rules))
+assert len(vs) > len(graphs)
+check(addSubset(graphs) >> repeat[2](rules + [removeO, closeRing]))
+config.dg.ignoreSubset = True
+check(addSubset(glycolaldehyde) >> addUniverse(formaldehyde) >> repeat[2](rules))
+config.dg.ignoreSubset = False
+check(addSubset(glycolaldehyde) >> addUniverse(formaldehyde) >> repeat[2](rules))
+
+# with stereo the composition is used
+check(addSubset(graphs) >> repeat[2](rules),
+	LabelSettings(LabelType.String, LabelRelation.Isomorphism, LabelRelation.Isomorphism))
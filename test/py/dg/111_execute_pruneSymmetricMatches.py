@@ -0,0 +1,24 @@
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+
+def summary(strat, prune):
+	config.dg.pruneSymmetricMatches = prune
+	dg = DG(graphDatabase=graphs)
+	with dg.build() as b:
+		res = b.execute(strat)
+	vs = sorted(v.graph.smiles for v in dg.vertices)
+	es = sorted((sorted(v.graph.smiles for v in e.sources), sorted(v.graph.smiles for v in e.targets),
+		sorted(r.name for r in e.rules)) for e in dg.edges)
+	pruned = sum(s.symmetricMatchesPruned for s in res.statistics.rules)
+	return (vs, es), pruned
+
+strat = addSubset(graphs) >> repeat[3](rules)
+ref, pruned = summary(strat, False)
+assert pruned == 0
+res, pruned = summary(strat, True)
+assert res == ref, "{}\n{}".format(ref, res)
+# e.g., the two hydrogens of formaldehyde
+assert pruned > 0
+config.dg.pruneSymmetricMatches = False
@@ -0,0 +1,50 @@
+import threading
+
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+
+# the Python callbacks are run one at a time, also when called from several threads
+active = [0, 0]
+lock = threading.Lock()
+def pred(d):
+	with lock:
+		active[0] += 1
+		active[1] = max(active[1], active[0])
+	with lock:
+		active[0] -= 1
+	return True
+
+def summary():
+	dg = DG(graphDatabase=graphs)
+	with dg.build() as b:
+		res = b.execute(addSubset(graphs) >> repeat[3](leftPredicate[pred](rules)))
+	# the statistics only count the isomorphism checks of this build
+	return sorted(v.graph.smiles for v in dg.vertices), res.statistics.isomorphismCalls
+
+config.common.numThreads = 4
+ref = summary()
+assert active[1] == 1
+
+# the GIL is released during the execution, so other Python threads can build at the same time
+results = [None] * 3
+def build(i):
+	results[i] = summary()
+threads = [threading.Thread(target=build, args=(i,)) for i in range(len(results))]
+for t in threads: t.start()
+for t in threads: t.join()
+assert all(res == ref for res in results)
+assert active[1] == 1
+
+# exceptions from callbacks in worker threads are raised again in the calling thread
+def failingPred(d):
+	raise ValueError("from a worker")
+dg = DG(graphDatabase=graphs)
+with dg.build() as b:
+	try:
+		b.execute(addSubset(graphs) >> leftPredicate[failingPred](rules))
+		assert False
+	except ValueError as e:
+		assert str(e) == "from a worker"
+config.common.numThreads = 1
@@ -0,0 +1,41 @@
+include("../formoseCommon/grammar.py")
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+
+def run(strat):
+	states = []
+	def record(gs):
+		states.append(([g.smiles for g in gs.subset], [g.smiles for g in gs.universe]))
+	dg = DG(graphDatabase=graphs)
+	with dg.build() as b:
+		b.execute(addSubset(graphs) >> repeat[2](rules) >> strat >> execute(record))
+	return states[0]
+
+# the key sort gives the same stable order as the comparison sort
+key = lambda g: -g.numVertices
+less = lambda g1, g2, gs: g1.numVertices > g2.numVertices
+assert run(sortSubsetByKey(key)) == run(sortSubset(less))
+assert run(sortUniverseByKey(key)) == run(sortUniverse(less))
+assert run(DGStrat.makeSortByKey(True, key)) == run(sortUniverse(less))
+nanKey = lambda g: float("nan") if g.numVertices == 4 else g.numVertices
+subset, universe = run(sortUniverseByKey(nanKey))
+assert universe[-1] == formaldehyde.smiles
+
+# the batch filter gives the same result as the per-graph filter
+pred = lambda g, gs, first: g.numVertices < 10
+calls = []
+def batchPred(graphList, gs):
+	calls.append(len(graphList))
+	return [g.numVertices < 10 for g in graphList]
+assert run(filterSubsetBatch(batchPred)) == run(filterSubset(pred))
+assert run(filterUniverseBatch(batchPred)) == run(filterUniverse(pred))
+assert len(calls) == 2
+subset, universe = run(DGStrat.makeFilterBatch(True, lambda graphList, gs: (True for g in graphList)))
+assert len(universe) == calls[1]
+
+try:
+	run(filterSubsetBatch(lambda graphList, gs: [True]))
+	assert False
+except LogicError:
+	pass
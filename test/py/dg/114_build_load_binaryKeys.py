@@ -0,0 +1,79 @@
+include("xx0_helpers.py")
+include("../formoseCommon/grammar.py")
+import struct
+
+# Binary dumps store the graph database keys, which must not be trusted blindly.
+
+graphs = [formaldehyde, glycolaldehyde]
+rules = [ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]
+
+dgRef = DG(graphDatabase=graphs)
+dgRef.build().execute(addSubset(graphs) >> repeat[2](rules))
+with open(dgRef.dumpBinary(), "rb") as f:
+	data = f.read()
+
+def readUInt(pos):
+	return struct.unpack_from("=Q", data, pos)[0], pos + 8
+
+def readString(pos):
+	n, pos = readUInt(pos)
+	return pos + n
+
+# the offsets of the signature and of the keys of each vertex
+sigOffset = 8 + 8 + 8
+numVertices, pos = readUInt(sigOffset + 8)
+pos += 2 * 8
+keyOffsets = []
+for i in range(numVertices):
+	_, pos = readUInt(pos)
+	pos = readString(pos)
+	n, pos = readUInt(pos)
+	for _ in range(n):
+		pos = readString(pos)
+	m, pos = readUInt(pos)
+	for _ in range(m):
+		pos = readString(pos + 2 * 8)
+	keyOffsets.append(pos)
+	pos += 3 * 8
+
+def tampered(name, changes):
+	d = bytearray(data)
+	for offset, value in changes:
+		struct.pack_into("=Q", d, offset, value)
+	with open(name, "wb") as f:
+		f.write(d)
+	return name
+
+def loadAndExtend(f):
+	dg = DG(graphDatabase=graphs)
+	with dg.build() as b:
+		b.load(rules, CWDPath(f))
+		b.execute(addSubset([v.graph for v in dg.vertices]) >> rules)
+	return dg
+
+def checkNoDuplicates(dg):
+	vs = [v.graph for v in dg.vertices]
+	for i in range(len(vs)):
+		for j in range(i + 1, len(vs)):
+			assert vs[i].isomorphism(vs[j]) == 0, (vs[i].name, vs[j].name)
+
+ref = loadAndExtend(dgRef.dumpBinary())
+checkNoDuplicates(ref)
+
+# keys from a different signature, e.g., another GraphCanon version, are recomputed
+signature, _ = readUInt(sigOffset)
+f = tampered("signature.dgb", [(sigOffset, signature ^ 1)] + [(o + 16, 0) for o in keyOffsets])
+dg = loadAndExtend(f)
+assert (dg.numVertices, dg.numEdges) == (ref.numVertices, ref.numEdges)
+checkNoDuplicates(dg)
+
+# keys which do not match their graphs are rejected
+for k in [0, 8]:
+	f = tampered("keys.dgb", [(keyOffsets[0] + k, 1000)])
+	dg = DG(graphDatabase=graphs)
+	with dg.build() as b:
+		try:
+			b.load(rules, CWDPath(f))
+			assert False
+		except InputError as e:
+			assert "does not match its graph" in str(e)
@@ -0,0 +1,22 @@
+a = smiles("CCCO", add=False)
+b = smiles("CC(C)O", add=False)
+c = smiles("COCC", add=False)
+p = smiles("CO", add=False)
+
+rejects = config.graph.numInvariantRejects
+assert a.isomorphism(b) == 0
+assert a.isomorphism(c) == 0
+assert a.isomorphism(smiles("OCCC", add=False)) == 1
+assert config.graph.numInvariantRejects > rejects
+
+assert p.monomorphism(a) == 1
+assert p.monomorphism(c) == 1
+assert a.monomorphism(p) == 0
+# more carbons than the host
+assert smiles("CC(C)(C)C", add=False).monomorphism(a) == 0
+
+# term labels only use the unlabelled invariants
+ls = LabelSettings(LabelType.Term, LabelRelation.Specialisation)
+g1 = graphGMLString('graph [ node [ id 0 label "_X" ] node [ id 1 label "a" ] edge [ source 0 target 1 label "b" ] ]', add=False)
+g2 = graphGMLString('graph [ node [ id 0 label "c" ] node [ id 1 label "a" ] edge [ source 0 target 1 label "b" ] ]', add=False)
+assert g1.monomorphism(g2, labelSettings=ls) == 1
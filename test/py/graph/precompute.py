@@ -0,0 +1,31 @@
+config.common.numThreads = 4
+
+smilesList = ["C", "CC", "CCO", "OCC=O", "c1ccccc1", "CC(C)(C)C", "O=C=O", "[H][H]"]
+graphs = [smiles(s) for s in smilesList]
+precomputeGraphs(graphs)
+precomputeGraphs(graphs, LabelSettings(LabelType.Term, LabelRelation.Specialisation))
+precomputeGraphs([])
+
+# the lazily computed data must be the same as without precomputation
+fresh = [smiles(s, add=False) for s in smilesList]
+for g, h in zip(graphs, fresh):
+	assert g.smiles == h.smiles
+	assert g.graphDFS == h.graphDFS
+	assert g.isomorphism(h) == 1
+
+canonicaliseGraphs(graphs + [graphDFS("[x][y]", add=False)])
+canonicaliseGraphs([])
+for g, h in zip(graphs, fresh):
+	assert g.smiles == h.smiles
+	assert g.graphDFS == h.graphDFS
+
+# precomputed graphs in a DG build, where the new products are canonicalised afterwards
+include("../formoseCommon/grammar.py")
+graphs = [formaldehyde, glycolaldehyde]
+precomputeGraphs(graphs)
+dg = DG(graphDatabase=graphs)
+dg.build().execute(addSubset(graphs) >> repeat[2]([ketoEnol_F, ketoEnol_B, aldolAdd_F, aldolAdd_B]))
+assert dg.numVertices > len(graphs)
+for v in dg.vertices:
+	assert v.graph.smiles == smiles(v.graph.smiles, add=False).smiles
+config.common.numThreads = 1
@@ -0,0 +1,44 @@
+graphs = [
+	smiles("C1CC1", name="cyclopropane"),
+	smiles("CCC", name="propane"),
+	smiles("C1CCC1", name="cyclobutane"),
+]
+
+def makeRule(constraints):
+	return ruleGMLString("""rule [
+	left [ node [ id 1 label "C" ] ]
+	context [
+		node [ id 0 label "C" ]
+		node [ id 2 label "C" ]
+		edge [ source 0 target 1 label "-" ]
+		edge [ source 1 target 2 label "-" ]
+	]
+	right [ node [ id 1 label "Si" ] ]
+	%s
+]""" % constraints, add=False)
+
+def educts(r, engine):
+	dg = DG(graphDatabase=graphs)
+	with dg.build() as b:
+		b.execute(addSubset(graphs) >> r, engine=engine)
+	return sorted({v.graph.name for e in dg.edges for v in e.sources})
+
+def check(constraints, expected):
+	r = makeRule(constraints)
+	for engine in [DGRuleApplicationEngine.Composition, DGRuleApplicationEngine.Direct]:
+		res = educts(r, engine)
+		assert res == expected, "{}: {} != {}".format(engine, res, expected)
+
+def path(op, length):
+	return 'constrainShortestPath [ source 0 target 2 op "%s" length %d ]' % (op, length)
+
+check(path("=", 1), ["cyclopropane"])
+check(path("=", 2), ["cyclobutane", "propane"])
+check(path(">", 2), [])
+check(path("<=", 2), ["cyclobutane", "cyclopropane", "propane"])
+check(path(">=", 2), ["cyclobutane", "propane"])
+
+adj = 'constrainAdj [ id 1 op "=" count %d nodeLabels [ label "H" ] ]'
+check(adj % 2, ["cyclobutane", "cyclopropane", "propane"])
+check(adj % 3, [])
+check(adj % 2 + path("<", 2), ["cyclopropane"])
@@ -0,0 +1,24 @@
+include("../formoseCommon/grammar_H.py")
+
+exps = [
+	rcExp(inputRules) *rcSuper* rcExp(inputRules),
+	rcExp(inputRules) *rcCommon* rcExp(inputRules),
+]
+
+def evaluate(exp):
+	rc = rcEvaluator(inputRules)
+	return rc.eval(exp), rc.products
+
+def sameUpToIsomorphism(a, b):
+	if len(a) != len(b): return False
+	return all(any(r.isomorphism(o) == 1 for o in b) for r in a)
+
+for exp in exps:
+	config.common.numThreads = 1
+	ref = evaluate(exp)
+	config.common.numThreads = 4
+	res = evaluate(exp)
+	config.common.numThreads = 1
+	assert len(ref[0]) > 0
+	assert sameUpToIsomorphism(res[0], ref[0])
+	assert sameUpToIsomorphism(res[1], ref[1])
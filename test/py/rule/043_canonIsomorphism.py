@@ -0,0 +1,102 @@
+import random
+
+# Rule isomorphism by canonical forms must agree with VF2 (string labels, no stereo).
+# Each spec is a list of vertices (membership, left label, right label)
+# and a list of edges (source, target, membership, left label, right label).
+# Each spec is instantiated with permuted ids and orders, so copies of the same spec must be isomorphic.
+
+random.seed(42)
+
+def makeGML(name, vs, es):
+	ids = list(range(len(vs)))
+	random.shuffle(ids)
+	ids = [10 + 3 * i for i in ids]
+	sides = {"left": [], "context": [], "right": []}
+	for i, (m, l, r) in enumerate(vs):
+		if m == "K" and l == r:
+			sides["context"].append('node [ id %d label "%s" ]' % (ids[i], l))
+			continue
+		if m in "LK": sides["left"].append('node [ id %d label "%s" ]' % (ids[i], l))
+		if m in "RK": sides["right"].append('node [ id %d label "%s" ]' % (ids[i], r))
+	for (s, t, m, l, r) in es:
+		if random.random() < 0.5: s, t = t, s
+		if m == "K" and l == r:
+			sides["context"].append('edge [ source %d target %d label "%s" ]' % (ids[s], ids[t], l))
+			continue
+		if m in "LK": sides["left"].append('edge [ source %d target %d label "%s" ]' % (ids[s], ids[t], l))
+		if m in "RK": sides["right"].append('edge [ source %d target %d label "%s" ]' % (ids[s], ids[t], r))
+	res = 'rule [ ruleID "%s"\n' % name
+	for side in ["left", "context", "right"]:
+		random.shuffle(sides[side])
+		res += "%s [\n%s\n]\n" % (side, "\n".join(sides[side]))
+	return res + "]"
+
+# a hydrogen moving from O to C
+base = ([("K", "C", "C"), ("K", "O", "O"), ("K", "H", "H")],
+	[(0, 1, "K", "-", "-"), (1, 2, "L", "-", None), (0, 2, "R", None, "-")])
+specs = {
+	"base": base,
+	# the inverse, i.e., with the left and right edge memberships swapped
+	"memberEdgeSwap": (base[0],
+		[(0, 1, "K", "-", "-"), (1, 2, "R", None, "-"), (0, 2, "L", "-", None)]),
+	# the hydrogen only in the left or right side
+	"memberVertexL": ([("K", "C", "C"), ("K", "O", "O"), ("L", "H", None)],
+		[(0, 1, "K", "-", "-"), (1, 2, "L", "-", None)]),
+	"memberVertexR": ([("K", "C", "C"), ("K", "O", "O"), ("R", None, "H")],
+		[(0, 1, "K", "-", "-"), (1, 2, "R", None, "-")]),
+	# the context bond only in the left or right side
+	"memberEdgeL": (base[0],
+		[(0, 1, "L", "-", None), (1, 2, "L", "-", None), (0, 2, "R", None, "-")]),
+	"memberEdgeR": (base[0],
+		[(0, 1, "R", None, "-"), (1, 2, "L", "-", None), (0, 2, "R", None, "-")]),
+	# edge label changes and their left/right swap
+	"edgeLabel": (base[0],
+		[(0, 1, "K", "-", "="), (1, 2, "L", "-", None), (0, 2, "R", None, "-")]),
+	"edgeLabelSwap": (base[0],
+		[(0, 1, "K", "=", "-"), (1, 2, "L", "-", None), (0, 2, "R", None, "-")]),
+	# vertex label changes and their left/right swap
+	"vertexLabel": ([("K", "C", "N"), ("K", "O", "O"), ("K", "H", "H")], base[1]),
+	"vertexLabelSwap": ([("K", "N", "C"), ("K", "O", "O"), ("K", "H", "H")], base[1]),
+	"vertexLabelOther": ([("K", "C", "C"), ("K", "O", "N"), ("K", "H", "H")], base[1]),
+	# symmetric rules, where swapping the two ends is an automorphism
+	"sym": ([("K", "C", "C"), ("K", "C", "C"), ("K", "O", "O"), ("K", "O", "O")],
+		[(0, 1, "K", "-", "-"), (0, 2, "L", "-", None), (1, 3, "L", "-", None),
+			(0, 3, "R", None, "-"), (1, 2, "R", None, "-")]),
+	"symBroken": ([("K", "C", "C"), ("K", "C", "C"), ("K", "O", "O"), ("K", "O", "O")],
+		[(0, 1, "K", "-", "-"), (0, 2, "L", "-", None), (1, 3, "L", "-", None),
+			(0, 3, "R", None, "-"), (1, 2, "R", None, "=")]),
+	# disconnected, with components which are only isomorphic on one side
+	"twoComp": ([("K", "C", "C"), ("K", "O", "O"), ("K", "C", "C"), ("K", "O", "O")],
+		[(0, 1, "L", "-", None), (2, 3, "R", None, "-")]),
+	# swapping the components is an isomorphism
+	"twoCompSwap": ([("K", "C", "C"), ("K", "O", "O"), ("K", "C", "C"), ("K", "O", "O")],
+		[(0, 1, "R", None, "-"), (2, 3, "L", "-", None)]),
+	"twoCompBoth": ([("K", "C", "C"), ("K", "O", "O"), ("K", "C", "C"), ("K", "O", "O")],
+		[(0, 1, "L", "-", None), (0, 1, "R", None, "="), (2, 3, "R", None, "-")]),
+}
+
+# the isomorphism classes of the specs
+classOf = {name: name for name in specs}
+classOf["twoCompSwap"] = "twoComp"
+
+rules = []
+for name, (vs, es) in sorted(specs.items()):
+	for i in range(3):
+		rules.append((name, ruleGMLString(makeGML("%s_%d" % (name, i), vs, es), add=False)))
+
+ls = LabelSettings(LabelType.String, LabelRelation.Isomorphism)
+
+def allPairs(alg):
+	config.graph.isomorphismAlg = alg
+	return [[a.isomorphism(b, labelSettings=ls) for (_, b) in rules] for (_, a) in rules]
+
+ref = allPairs(IsomorphismAlg.VF2)
+res = allPairs(IsomorphismAlg.Canon)
+config.graph.isomorphismAlg = IsomorphismAlg.VF2
+
+for i, (nA, a) in enumerate(rules):
+	for j, (nB, b) in enumerate(rules):
+		if res[i][j] != ref[i][j]:
+			print("Mismatch: %s vs. %s, canon %d, VF2 %d" % (a.name, b.name, res[i][j], ref[i][j]))
+			assert False
+		assert ref[i][j] == (1 if classOf[nA] == classOf[nB] else 0)
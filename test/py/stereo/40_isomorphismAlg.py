@@ -0,0 +1,70 @@
+# Compare the isomorphism algorithms on a stereo-heavy set of graphs:
+# all algorithms must agree, and the graph database must deduplicate exactly the copies.
+# The timings are in benchmarks/cpp/stereoIsomorphism.cpp.
+
+bases = [
+	"OC(=O)[C@@H](O)[C@H](O)C(=O)O",
+	"OC(=O)[C@H](O)[C@@H](O)C(=O)O",
+	"OC(=O)[C@@H](O)[C@@H](O)C(=O)O",
+	"OC(=O)[C@H](O)[C@H](O)C(=O)O",
+	"OC[C@H]1OC(O)[C@H](O)[C@@H](O)[C@@H]1O",
+	"OC[C@H]1OC(O)[C@H](O)[C@@H](O)[C@H]1O",
+	"OC[C@H]1OC(O)[C@@H](O)[C@@H](O)[C@@H]1O",
+	"OC[C@@H]1OC(O)[C@H](O)[C@@H](O)[C@@H]1O",
+	"C[C@H](N)C(=O)O",
+	"C[C@@H](N)C(=O)O",
+	"CC(N)C(=O)O",
+	"C/C=C/C",
+	"C/C=C\\C",
+	"CC=CC",
+	"F/C=C/C=C/F",
+	"F/C=C\\C=C/F",
+	"F/C=C/C=C\\F",
+]
+# the same molecules again, as separate objects
+graphs = [smiles(s, name="g%d" % i) for i, s in enumerate(bases)]
+graphs += [smiles(s, name="g%d'" % i) for i, s in enumerate(bases)]
+
+lsStereo = LabelSettings(LabelType.String, LabelRelation.Isomorphism, LabelRelation.Isomorphism)
+lsPlain = LabelSettings(LabelType.String, LabelRelation.Isomorphism)
+
+algs = [IsomorphismAlg.VF2, IsomorphismAlg.SmilesCanonVF2, IsomorphismAlg.Canon]
+
+def allPairs(ls):
+	return [[a.isomorphism(b, labelSettings=ls) for b in graphs] for a in graphs]
+
+def dgDatabase(ls):
+	# all the originals are pairwise non-isomorphic
+	dg = DG(labelSettings=ls, graphDatabase=graphs[:len(bases)])
+	assert len(dg.graphDatabase) == len(bases)
+	# and each copy must be found
+	for i in range(len(bases)):
+		try:
+			DG(labelSettings=ls, graphDatabase=[graphs[i], graphs[len(bases) + i]])
+			assert False
+		except LogicError as e:
+			assert "Isomorphic graphs" in str(e)
+
+results = {}
+for alg in algs:
+	config.graph.isomorphismAlg = alg
+	results[alg] = {
+		"plain": allPairs(lsPlain),
+		"stereo": allPairs(lsStereo),
+	}
+	dgDatabase(lsStereo)
+config.graph.isomorphismAlg = IsomorphismAlg.VF2
+
+ref = results[IsomorphismAlg.VF2]
+for alg in algs:
+	res = results[alg]
+	for k in ["plain", "stereo"]:
+		for i in range(len(graphs)):
+			for j in range(len(graphs)):
+				if res[k][i][j] != ref[k][i][j]:
+					print("Mismatch for %s, %s: %s vs. %s" % (alg, k, graphs[i].name, graphs[j].name))
+					print("Result: %d, expected %d" % (res[k][i][j], ref[k][i][j]))
+					assert False
+
+# without stereo some of the molecules collapse
+assert sum(ref["plain"][0]) > sum(ref["stereo"][0])